@@ -0,0 +1,424 @@
+//
+//  ExecutionBenchmarks.cpp
+//  Execution
+//
+//  Created by FireWolf on 2026-10-14.
+//
+
+#include <Execution/Common/TaskControlBlockComponents.hpp>
+#include <Execution/Common/PooledTaskController.hpp>
+#include <Execution/Common/ServiceRoutineTable.hpp>
+#include <Execution/Common/DispatcherProfiler.hpp>
+#include <Execution/Common/TraceRing.hpp>
+#include <Execution/SimpleThreadBased/KernelServiceRoutines.hpp>
+#include <Execution/SimpleEventDriven/KernelServiceRoutines.hpp>
+#include "HostContextSwitcher.hpp"
+#include <cstdio>
+#include <cstdlib>
+
+//
+// MARK: - Task Control Block
+//
+
+struct BenchmarkTask;
+
+using BenchmarkSwitcher = HostContextSwitcher<BenchmarkTask>;
+
+struct BenchmarkTask:
+    TaskControlBlockComponents::DedicatedRecyclableStackSupport<BenchmarkTask>,
+    TaskControlBlockComponents::SystemCallSupport<BenchmarkTask, HostExecutionContext>,
+    TaskControlBlockComponents::UniqueNumericIdentifierSupport<BenchmarkTask, UInt32>,
+    HostFiberSupport<BenchmarkTask>
+{
+    /// `true` if the task preempts the current task when it becomes ready, e.g. an event handler
+    bool urgent = false;
+};
+
+/// System calls serviced by the benchmark kernel
+enum BenchmarkSyscall: UInt32
+{
+    kNull,
+    kYield,
+    kCreateThread,
+    kFinishThread,
+    kSendEvent,
+    kEventHandlerReturn,
+    kShutdown,
+};
+
+//
+// MARK: - Scheduler and Controller
+//
+
+///
+/// A first-in-first-out scheduler in which urgent tasks preempt the current task
+///
+/// @note The scheduler stores ready tasks in a fixed ring, so the benchmarks do not measure the heap.
+///
+struct BenchmarkScheduler
+{
+private:
+    static constexpr size_t kCapacity = 64;
+
+    BenchmarkTask* tasks[kCapacity];
+
+    size_t head = 0;
+
+    size_t count = 0;
+
+    void pushBack(BenchmarkTask* task)
+    {
+        precondition(this->count < kCapacity, "The ready queue is full.");
+
+        this->tasks[(this->head + this->count) % kCapacity] = task;
+
+        this->count += 1;
+    }
+
+    void pushFront(BenchmarkTask* task)
+    {
+        precondition(this->count < kCapacity, "The ready queue is full.");
+
+        this->head = (this->head + kCapacity - 1) % kCapacity;
+
+        this->tasks[this->head] = task;
+
+        this->count += 1;
+    }
+
+    BenchmarkTask* popFront()
+    {
+        precondition(this->count > 0, "No task is ready to run.");
+
+        BenchmarkTask* task = this->tasks[this->head];
+
+        this->head = (this->head + 1) % kCapacity;
+
+        this->count -= 1;
+
+        return task;
+    }
+
+public:
+    BenchmarkTask* onTaskCreated(BenchmarkTask* current, BenchmarkTask* task)
+    {
+        if (task->urgent)
+        {
+            this->pushFront(current);
+
+            return task;
+        }
+
+        this->pushBack(task);
+
+        return current;
+    }
+
+    BenchmarkTask* onTaskFinished([[maybe_unused]] BenchmarkTask* task)
+    {
+        return this->popFront();
+    }
+
+    BenchmarkTask* onTaskYield(BenchmarkTask* current)
+    {
+        this->pushBack(current);
+
+        return this->popFront();
+    }
+
+    void reset()
+    {
+        this->head = 0;
+
+        this->count = 0;
+    }
+};
+
+OSDeclareTaskSchedulerWithKernelServiceRoutine(BenchmarkScheduler, scheduler)
+
+using BenchmarkController = PooledTaskController<BenchmarkTask, 16>;
+
+OSDeclareTaskControllerWithKernelServiceRoutine(BenchmarkController, controller)
+
+//
+// MARK: - Kernel Service Routines
+//
+
+/// Benchmarks never print from the dispatch path
+using BenchmarkLog = ExecutionLog<ExecutionLogLevel::None>;
+
+static constexpr size_t kThreadStackSize = 16 * 1024;
+
+static constexpr size_t kNumThreadStacks = 4;
+
+static constexpr size_t kNumEventHandlers = 1;
+
+/// Event handlers are statically allocated, like those of the event driven model on the target
+static BenchmarkTask handlers[kNumEventHandlers];
+
+struct BenchmarkEventMapper
+{
+    BenchmarkTask* operator()(int event)
+    {
+        return &handlers[event];
+    }
+};
+
+struct NullServiceRoutine
+{
+    BenchmarkTask* operator()(BenchmarkTask* task)
+    {
+        task->setSyscallKernelReturnValue(0);
+
+        return task;
+    }
+};
+
+struct YieldServiceRoutine
+{
+    BenchmarkTask* operator()(BenchmarkTask* task)
+    {
+        return KernelServiceRoutines::GetTaskScheduler<BenchmarkScheduler>().onTaskYield(task);
+    }
+};
+
+struct ShutdownServiceRoutine
+{
+    BenchmarkTask* operator()([[maybe_unused]] BenchmarkTask* task)
+    {
+        BenchmarkSwitcher::shutdown();
+    }
+};
+
+using CreateThreadServiceRoutine = KernelServiceRoutines::CreateThread::ServiceRoutineBuilderWithTaskArgs<
+    BenchmarkTask, BenchmarkScheduler, BenchmarkController,
+    KernelServiceRoutines::CreateThread::KPI::PooledStackAllocator<BenchmarkTask, kThreadStackSize, kNumThreadStacks>,
+    KernelServiceRoutines::CreateThread::KPI::SetupExecutionContext<BenchmarkTask, HostThreadContextBuilder<BenchmarkSwitcher, kFinishThread>>,
+    KernelServiceRoutines::CreateThread::KPI::AssignUniqueIdentifier<BenchmarkTask>>;
+
+using FinishThreadServiceRoutine = KernelServiceRoutines::FinishThread::ServiceRoutineBuilder<
+    BenchmarkTask, BenchmarkScheduler, BenchmarkController,
+    KernelServiceRoutines::FinishThread::KPI::ReleasePooledStack<BenchmarkTask, kThreadStackSize, kNumThreadStacks>>;
+
+using SendEventServiceRoutine = KernelServiceRoutines::SyscallSendEvent<BenchmarkTask, BenchmarkScheduler, BenchmarkEventMapper, BenchmarkLog>;
+
+using EventHandlerReturnServiceRoutine = KernelServiceRoutines::SyscallEventHandlerReturn<BenchmarkTask, BenchmarkScheduler, BenchmarkLog>;
+
+OSDefineAndRouteKernelRoutine(ksrNull, BenchmarkTask, NullServiceRoutine)
+OSDefineAndRouteKernelRoutine(ksrYield, BenchmarkTask, YieldServiceRoutine)
+OSDefineAndRouteKernelRoutine(ksrCreateThread, BenchmarkTask, CreateThreadServiceRoutine)
+OSDefineAndRouteKernelRoutine(ksrFinishThread, BenchmarkTask, FinishThreadServiceRoutine)
+OSDefineAndRouteKernelRoutine(ksrSendEvent, BenchmarkTask, SendEventServiceRoutine)
+OSDefineAndRouteKernelRoutine(ksrEventHandlerReturn, BenchmarkTask, EventHandlerReturnServiceRoutine)
+OSDefineAndRouteKernelRoutine(ksrShutdown, BenchmarkTask, ShutdownServiceRoutine)
+
+using BenchmarkMapper = StaticServiceRoutineTable<UInt32, &ksrNull, &ksrYield, &ksrCreateThread, &ksrFinishThread, &ksrSendEvent, &ksrEventHandlerReturn, &ksrShutdown>;
+
+//
+// MARK: - Dispatchers
+//
+
+using BenchmarkTraceRing = TraceRing<HostCycleCounter, 1024>;
+
+using BenchmarkProfiler = DispatcherProfiler<BenchmarkTask, UInt32, HostCycleCounter, 8, 16>;
+
+/// The dispatcher without any injectors
+using BareDispatcher = Dispatcher<BenchmarkTask, UInt32, BenchmarkMapper, BenchmarkSwitcher>;
+
+/// The dispatcher with the trace recorder and the profiler, both of which are typical injectors in a debug kernel
+using InstrumentedDispatcher = Dispatcher<BenchmarkTask, UInt32, BenchmarkMapper, BenchmarkSwitcher,
+                                          TraceRecorder<BenchmarkTask, BenchmarkTraceRing>, BenchmarkProfiler>;
+
+//
+// MARK: - Benchmarks
+//
+
+/// The number of iterations of each benchmark
+static size_t iterations = 100000;
+
+/// The result reported by the task that drives a benchmark
+static UInt64 elapsed = 0;
+
+/// The total latency from sending an event to the start of its handler
+static UInt64 latency = 0;
+
+/// The timestamp when the latest event is sent
+static UInt64 sentAt = 0;
+
+/// Tasks that drive benchmarks and their stacks
+static BenchmarkTask idle, driver, partner;
+
+alignas(16) static UInt8 driverStack[kThreadStackSize];
+
+alignas(16) static UInt8 partnerStack[kThreadStackSize];
+
+alignas(16) static UInt8 handlerStacks[kNumEventHandlers][kThreadStackSize];
+
+/// Prepare a statically allocated task that runs the given function on the given stack
+static void prepare(BenchmarkTask* task, UInt8* stack, void (*entry)(), UInt32 identifier, bool urgent = false)
+{
+    task->setPrivateStack(stack);
+
+    task->setStackPointer(stack + kThreadStackSize);
+
+    task->setUniqueIdentifier(identifier);
+
+    task->urgent = urgent;
+
+    HostThreadContextBuilder<BenchmarkSwitcher, kFinishThread>{}(task, reinterpret_cast<const UInt8*>(entry));
+}
+
+/// Run the given function as the driver task on the given dispatcher and return the elapsed time in nanoseconds
+template <typename Dispatcher>
+static UInt64 measure(void (*entry)())
+{
+    scheduler.reset();
+
+    elapsed = 0;
+
+    prepare(&driver, driverStack, entry, 1);
+
+    BenchmarkSwitcher::run<Dispatcher>(&idle, &driver);
+
+    return elapsed;
+}
+
+/// Print the result of a benchmark
+static void report(const char* name, UInt64 nanoseconds, size_t operations)
+{
+    printf("%-48s %12zu ops %10.1f ns/op\n", name, operations, static_cast<double>(nanoseconds) / static_cast<double>(operations));
+}
+
+/// [Driver] Invoke the null system call repeatedly, which returns to the caller via the fast path
+static void nullSyscallDriver()
+{
+    UInt64 start = HostCycleCounter::now();
+
+    for (size_t index = 0; index < iterations; index += 1)
+    {
+        BenchmarkSwitcher::trap(kNull);
+    }
+
+    elapsed = HostCycleCounter::now() - start;
+
+    BenchmarkSwitcher::trap(kShutdown);
+}
+
+/// [Partner] Yield to the driver forever
+static void yieldPartner()
+{
+    while (true)
+    {
+        BenchmarkSwitcher::trap(kYield);
+    }
+}
+
+/// [Driver] Yield to the partner repeatedly, each of which takes two context switches
+static void yieldDriver()
+{
+    prepare(&partner, partnerStack, &yieldPartner, 2);
+
+    scheduler.onTaskCreated(&driver, &partner);
+
+    UInt64 start = HostCycleCounter::now();
+
+    for (size_t index = 0; index < iterations; index += 1)
+    {
+        BenchmarkSwitcher::trap(kYield);
+    }
+
+    elapsed = HostCycleCounter::now() - start;
+
+    BenchmarkSwitcher::trap(kShutdown);
+}
+
+/// [Handler] Record the latency of each event and return from the handler
+static void eventHandler()
+{
+    while (true)
+    {
+        latency += HostCycleCounter::now() - sentAt;
+
+        BenchmarkSwitcher::trap(kEventHandlerReturn, BenchmarkSwitcher::getCurrentTask()->getStackPointer());
+    }
+}
+
+/// [Driver] Send an event to an urgent handler repeatedly, each of which preempts the driver
+static void sendEventDriver()
+{
+    prepare(&handlers[0], handlerStacks[0], &eventHandler, 3, true);
+
+    latency = 0;
+
+    UInt64 start = HostCycleCounter::now();
+
+    for (size_t index = 0; index < iterations; index += 1)
+    {
+        sentAt = HostCycleCounter::now();
+
+        BenchmarkSwitcher::trap(kSendEvent, 0);
+    }
+
+    elapsed = HostCycleCounter::now() - start;
+
+    BenchmarkSwitcher::trap(kShutdown);
+}
+
+/// [Thread] An empty thread that finishes immediately
+static void emptyThread() {}
+
+/// [Driver] Create an empty thread and yield to it repeatedly, so that each thread is created, run and destroyed
+static void createThreadDriver()
+{
+    UInt64 start = HostCycleCounter::now();
+
+    for (size_t index = 0; index < iterations; index += 1)
+    {
+        if (BenchmarkSwitcher::trap(kCreateThread, kThreadStackSize, reinterpret_cast<const UInt8*>(&emptyThread), static_cast<UInt32>(index)) != 0)
+        {
+            pfatal("Failed to create a thread.");
+        }
+
+        BenchmarkSwitcher::trap(kYield);
+    }
+
+    elapsed = HostCycleCounter::now() - start;
+
+    BenchmarkSwitcher::trap(kShutdown);
+}
+
+///
+/// Run all benchmarks
+///
+/// @note Usage: `ExecutionBenchmarks [iterations]`.
+///
+int main(int argc, const char* argv[])
+{
+    if (argc > 1)
+    {
+        iterations = std::strtoul(argv[1], nullptr, 10);
+    }
+
+    if (iterations == 0)
+    {
+        perr("The number of iterations must be positive.");
+
+        return EXIT_FAILURE;
+    }
+
+    report("Syscall round trip (fast return)", measure<BareDispatcher>(&nullSyscallDriver), iterations);
+
+    report("Syscall round trip (fast return, instrumented)", measure<InstrumentedDispatcher>(&nullSyscallDriver), iterations);
+
+    report("Context switch (yield, no injectors)", measure<BareDispatcher>(&yieldDriver), 2 * iterations);
+
+    report("Context switch (yield, instrumented)", measure<InstrumentedDispatcher>(&yieldDriver), 2 * iterations);
+
+    report("Event send and handler return", measure<BareDispatcher>(&sendEventDriver), iterations);
+
+    report("Event send to handler start (latency)", latency, iterations);
+
+    report("Thread create, run and destroy", measure<BareDispatcher>(&createThreadDriver), iterations);
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,309 @@
+//
+//  HostContextSwitcher.hpp
+//  Execution
+//
+//  Created by FireWolf on 2026-10-14.
+//
+
+#ifndef Execution_HostContextSwitcher_hpp
+#define Execution_HostContextSwitcher_hpp
+
+#include <Types.hpp>
+#include <Debug.hpp>
+#include <Execution/Common/ContextSwitcher.hpp>
+#include <Execution/Common/ExecutionContext.hpp>
+#include <chrono>
+#include <cstdarg>
+#include <ucontext.h>
+
+///
+/// The execution context saved by a simulated trap on the host
+///
+/// @note The frame resides on the stack of the task that invokes the system call,
+///       and the stack pointer of the task points to the frame while the task is in the kernel,
+///       so `SystemCallSupport` reads system call arguments exactly like it does on the hardware.
+///
+struct HostExecutionContext
+{
+    /// The system call identifier
+    UInt32 identifier;
+
+    /// The variadic argument list of the trap
+    va_list* arguments;
+
+    /// The kernel return value
+    int kernelReturnValue;
+
+    UInt32 getSyscallIdentifier()
+    {
+        return this->identifier;
+    }
+
+    va_list* getSyscallArgumentList()
+    {
+        return this->arguments;
+    }
+
+    void setSyscallKernelReturnValue(int krv)
+    {
+        this->kernelReturnValue = krv;
+    }
+};
+
+static_assert(ExecutionContextProvidesSystemCallSupport<HostExecutionContext>);
+
+///
+/// A cycle counter that reads the monotonic clock of the host in nanoseconds
+///
+struct HostCycleCounter
+{
+    using Cycles = UInt64;
+
+    static Cycles now()
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+};
+
+///
+/// Provide the host fiber that simulates the execution context of a task
+///
+/// @tparam Task Specify the type of the concrete task control block
+/// @note This component is used by `HostContextSwitcher` and is not meant for the target.
+///
+template <typename Task>
+struct HostFiberSupport
+{
+private:
+    ucontext_t fiber;
+
+    const UInt8* entryPoint = nullptr;
+
+public:
+    ucontext_t* getHostFiber()
+    {
+        return &this->fiber;
+    }
+
+    const UInt8* getEntryPoint()
+    {
+        return this->entryPoint;
+    }
+
+    void setEntryPoint(const UInt8* entry)
+    {
+        this->entryPoint = entry;
+    }
+};
+
+///
+/// A context switcher that runs the kernel and each task on its own host fiber
+///
+/// @tparam T Specify the type of the task control block that has a host fiber
+/// @tparam KernelStackSize Specify the size of the stack on which the dispatcher loop runs
+/// @note The dispatcher loop runs on the kernel fiber and never returns,
+///       so `run()` starts a fresh kernel fiber and returns to the caller once a service routine invokes `shutdown()`.
+/// @note A task enters the kernel with `trap()`, which builds a `HostExecutionContext` on the stack of the task,
+///       and leaves the kernel when the dispatcher switches back to its fiber.
+/// @note Fibers are switched with `swapcontext()`, which also saves the signal mask of the host process,
+///       so absolute numbers are larger than those on the hardware. Compare runs built with the same host toolchain.
+///
+template <typename T, size_t KernelStackSize = 64 * 1024>
+struct HostContextSwitcher
+{
+    using Task = T;
+
+    using ServiceIdentifier = UInt32;
+
+private:
+    /// The fiber on which the dispatcher loop runs
+    static inline ucontext_t kernel;
+
+    /// The context of the caller of `run()`
+    static inline ucontext_t host;
+
+    /// The stack of the kernel fiber
+    alignas(16) static inline UInt8 kernelStack[KernelStackSize];
+
+    /// The task that is running on the host
+    static inline Task* current = nullptr;
+
+    /// The identifier passed by the last trap
+    static inline ServiceIdentifier identifier = 0;
+
+    /// The initial tasks passed to the dispatcher
+    static inline Task* initialPrev = nullptr;
+
+    static inline Task* initialNext = nullptr;
+
+    /// Private helper to create the dispatcher and enter its loop on the kernel fiber
+    template <typename Dispatcher>
+    static void enter()
+    {
+        Dispatcher(initialPrev, initialNext).dispatch();
+    }
+
+public:
+    ///
+    /// Switch to the given task and return when the task traps into the kernel
+    ///
+    /// @param prev The task that is interrupted
+    /// @param next The task that is selected to run
+    /// @return The identifier passed by the trap.
+    ///
+    static ServiceIdentifier switchTask([[maybe_unused]] Task* prev, Task* next)
+    {
+        current = next;
+
+        swapcontext(&kernel, next->getHostFiber());
+
+        return identifier;
+    }
+
+    ///
+    /// Return to the interrupted task and return when the task traps into the kernel again
+    ///
+    /// @param task The task that is interrupted
+    /// @return The identifier passed by the trap.
+    /// @note Fibers do not distinguish the fast return path, but providing it exercises the dispatcher branch that skips injectors.
+    ///
+    static ServiceIdentifier returnToTask(Task* task)
+    {
+        return switchTask(task, task);
+    }
+
+    ///
+    /// [USER] Enter the kernel with the given system call identifier and arguments
+    ///
+    /// @param id The system call identifier
+    /// @return The kernel return value.
+    ///
+    static int trap(ServiceIdentifier id, ...)
+    {
+        va_list arguments;
+
+        va_start(arguments, id);
+
+        HostExecutionContext frame = { id, &arguments, 0 };
+
+        Task* task = current;
+
+        UInt8* stackPointer = task->getStackPointer();
+
+        task->setStackPointer(reinterpret_cast<UInt8*>(&frame));
+
+        identifier = id;
+
+        swapcontext(task->getHostFiber(), &kernel);
+
+        // Back to the task: Pop the frame unless the kernel has moved the stack pointer
+        if (task->getStackPointer() == reinterpret_cast<UInt8*>(&frame))
+        {
+            task->setStackPointer(stackPointer);
+        }
+
+        va_end(arguments);
+
+        return frame.kernelReturnValue;
+    }
+
+    ///
+    /// Run the kernel dispatcher loop until a service routine invokes `shutdown()`
+    ///
+    /// @tparam Dispatcher Specify the type of the dispatcher
+    /// @param prev The task that is assumed to be interrupted, typically the idle task
+    /// @param next The first task that will run
+    ///
+    template <typename Dispatcher>
+    static void run(Task* prev, Task* next)
+    {
+        initialPrev = prev;
+
+        initialNext = next;
+
+        getcontext(&kernel);
+
+        kernel.uc_stack.ss_sp = kernelStack;
+
+        kernel.uc_stack.ss_size = KernelStackSize;
+
+        kernel.uc_link = nullptr;
+
+        makecontext(&kernel, &enter<Dispatcher>, 0);
+
+        swapcontext(&host, &kernel);
+    }
+
+    ///
+    /// [KERNEL] Leave the dispatcher loop and return to the caller of `run()`
+    ///
+    /// @note This function must be invoked by a service routine and does not return.
+    ///
+    __attribute__((noreturn))
+    static void shutdown()
+    {
+        setcontext(&host);
+
+        __builtin_unreachable();
+    }
+
+    ///
+    /// Get the task that is running on the host
+    ///
+    /// @return The task that has been switched to run most recently.
+    ///
+    static Task* getCurrentTask()
+    {
+        return current;
+    }
+};
+
+///
+/// A context builder that prepares the host fiber of a new thread, used by `CreateThread::KPI::SetupExecutionContext`
+///
+/// @tparam Switcher Specify the host context switcher
+/// @tparam FinishIdentifier Specify the system call identifier that terminates the current thread
+/// @note The fiber runs on the dedicated stack assigned by stack initializers,
+///       i.e. from the private stack to the current stack pointer,
+///       and invokes `FinishIdentifier` when the entry point returns.
+///
+template <typename Switcher, typename Switcher::ServiceIdentifier FinishIdentifier>
+struct HostThreadContextBuilder
+{
+    using Task = typename Switcher::Task;
+
+private:
+    /// Private trampoline that runs the entry point of the current task
+    static void start()
+    {
+        Task* task = Switcher::getCurrentTask();
+
+        reinterpret_cast<void (*)()>(const_cast<UInt8*>(task->getEntryPoint()))();
+
+        Switcher::trap(FinishIdentifier);
+
+        pfatal("A finished thread has been resumed.");
+    }
+
+public:
+    void operator()(Task* task, const UInt8* entryPoint)
+    {
+        UInt8* stack = task->getPrivateStack();
+
+        ucontext_t* fiber = task->getHostFiber();
+
+        getcontext(fiber);
+
+        fiber->uc_stack.ss_sp = stack;
+
+        fiber->uc_stack.ss_size = static_cast<size_t>(task->getStackPointer() - stack);
+
+        fiber->uc_link = nullptr;
+
+        makecontext(fiber, &start, 0);
+
+        task->setEntryPoint(entryPoint);
+    }
+};
+
+#endif /* Execution_HostContextSwitcher_hpp */
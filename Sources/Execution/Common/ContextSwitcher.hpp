@@ -35,4 +35,28 @@ concept ContextSwitcher = requires(typename Switcher::Task* prev, typename Switc
     { Switcher::switchTask(prev, next) } -> std::same_as<typename Switcher::ServiceIdentifier>;
 };
 
+///
+/// Specify the constraint for the context switcher that provides a fast path to return to the interrupted task
+///
+/// @note The dispatcher uses the fast path when the service routine selects the interrupted task to run again,
+///       e.g. the scheduler decides not to preempt the current task after an event is sent.
+///       In this case, the stack pointer of the task is unchanged, so the switcher only needs to exit the kernel
+///       and resume the task instead of performing a full context switch.
+///
+template <typename Switcher>
+concept ContextSwitcherProvidesFastReturn = requires(typename Switcher::Task* task)
+{
+    ///
+    /// The context switcher must satisfy the basic context switcher interface
+    ///
+    requires ContextSwitcher<Switcher>;
+
+    ///
+    /// The context switcher must implement the static function that returns to the given task and provides kernel entry and exit points
+    ///
+    /// @note Signature: `static ServiceIdentifier returnToTask(Task* task)`.
+    ///
+    { Switcher::returnToTask(task) } -> std::same_as<typename Switcher::ServiceIdentifier>;
+};
+
 #endif /* Execution_ContextSwitcher_hpp */
@@ -0,0 +1,34 @@
+//
+//  CycleCounter.hpp
+//  Execution
+//
+//  Created by FireWolf on 2026-10-14.
+//
+
+#ifndef Execution_CycleCounter_hpp
+#define Execution_CycleCounter_hpp
+
+#include <concepts>
+
+///
+/// Specify the constraint of the architecture-dependent cycle counter
+///
+/// @example Read `DWT->CYCCNT` on Cortex-M or `PMCCNTR` on Cortex-A.
+///
+template <typename Counter>
+concept CycleCounter = requires
+{
+    ///
+    /// The counter must explicitly define the type of the cycle count
+    ///
+    typename Counter::Cycles;
+
+    requires std::unsigned_integral<typename Counter::Cycles>;
+
+    ///
+    /// The counter must implement the static function that returns the current cycle count
+    ///
+    { Counter::now() } -> std::same_as<typename Counter::Cycles>;
+};
+
+#endif /* Execution_CycleCounter_hpp */
@@ -51,6 +51,26 @@ concept KernelServiceRoutineMapper = requires(const Identifier& identifier)
     { Mapper{}(identifier) } -> std::same_as<typename Mapper::Task* (*)(typename Mapper::Task*)>;
 };
 
+/// Define the interface of the kernel service routine mapper that can invoke the routine directly
+template <typename Mapper, typename Identifier>
+concept KernelServiceRoutineMapperProvidesDirectInvocation = requires(const Identifier& identifier, typename Mapper::Task* task)
+{
+    ///
+    /// The mapper must satisfy the basic mapper interface
+    ///
+    requires KernelServiceRoutineMapper<Mapper, Identifier>;
+
+    ///
+    /// The mapper must implement the static function that consumes a service identifier and the interrupted task,
+    /// invokes the corresponding service routine and returns the non-null next task.
+    ///
+    /// @note Signature `static Task* invoke(const Identifier& identifier, Task* task)`.
+    /// @note The dispatcher prefers this function if available,
+    ///       so that the compiler is able to inline service routines or lower the lookup to a jump table.
+    ///
+    { Mapper::invoke(identifier, task) } -> std::same_as<typename Mapper::Task*>;
+};
+
 ///
 /// Define the interface of injecting code before a task is switched to run
 ///
@@ -70,6 +90,32 @@ concept DispatcherCodeInjector = requires(Task* prev, Task* next)
     { Injector{}(prev, next) } -> std::same_as<void>;
 };
 
+///
+/// Define the interface of injecting code when the kernel is entered and when the service routine returns
+///
+/// @note i.e. Immediately after `ContextSwitcher::switchTask(from:to:)` returns and immediately after the service routine returns.
+/// @note This is an optional refinement of `DispatcherCodeInjector`,
+///       so the dispatcher invokes these hooks only on injectors that implement them.
+///
+template <typename Injector, typename Task, typename ServiceIdentifier>
+concept DispatcherCodeInjectorProvidesServiceRoutineHooks = requires(Task* prev, Task* next, const ServiceIdentifier& identifier)
+{
+    ///
+    /// The injector must satisfy the basic injector interface
+    ///
+    requires DispatcherCodeInjector<Injector, Task>;
+
+    ///
+    /// The injector must implement the function that consumes the interrupted task and the service identifier
+    ///
+    { Injector{}.onServiceRoutineEnter(prev, identifier) } -> std::same_as<void>;
+
+    ///
+    /// The injector must implement the function that consumes the interrupted task, the task selected to run and the service identifier
+    ///
+    { Injector{}.onServiceRoutineExit(prev, next, identifier) } -> std::same_as<void>;
+};
+
 ///
 /// The dispatcher acts as the front desk for all system calls, hardware interrupts and exceptions
 ///
@@ -78,6 +124,7 @@ concept DispatcherCodeInjector = requires(Task* prev, Task* next)
 /// @tparam RoutineMapper Specify the mapper that maps an identifier to the corresponding service routine
 /// @tparam ContextSwitcher Specify the type of the context switcher
 /// @tparam Injector A list of injector to inject code before the task is switched to run
+///                  and optionally around the invocation of the service routine
 /// @note The dispatcher relies on the context switcher that provides both kernel entry and exit points.
 ///       It uses the service identifier returned by `ContextSwitcher::switch(from:to:)` to invoke the corresponding service routine.
 ///       The exact meaning of the identifier is up to developers. For example, it can be the trap number on x86.
@@ -85,7 +132,11 @@ concept DispatcherCodeInjector = requires(Task* prev, Task* next)
 ///       The returned function takes a reference to the current interrupted task and returns the non-null next task.
 ///       The dispatcher then invokes the context switcher to switch from the current task to the next one.
 /// @note Tinkertoy provides a convenient macro to declare the routine function and routes to existing modular building blocks.
+/// @note If the mapper also provides direct invocation support, the dispatcher invokes the routine via the mapper instead.
 /// @see `OSDefineAndRouteKernelRoutine` for detailed explanation.
+/// @see `StaticServiceRoutineTable` for a compile-time mapper that provides direct invocation support.
+/// @note If the context switcher provides the fast return path, the dispatcher uses it when the interrupted task is selected to run again.
+/// @see `ContextSwitcherProvidesFastReturn` for detailed explanation.
 /// @see Refer to the constraint definition of `KernelServiceRoutine` and `ContextSwitcher`.
 ///
 template <typename Task, typename ServiceIdentifier, typename ServiceRoutineMapper, typename Switcher, DispatcherCodeInjector<Task>... Injector>
@@ -103,6 +154,50 @@ private:
     /// The task that is selected to run
     Task* next;
 
+    ///
+    /// Switch from the interrupted task to the task that is selected to run and exit the kernel
+    ///
+    /// @return The service identifier returned by the context switcher when the control is back to the kernel.
+    /// @note If the context switcher provides the fast return path and the interrupted task is selected to run again,
+    ///       the dispatcher skips code injections and resumes the task directly.
+    ///       As such, injectors must not depend on being invoked when the previous and the next task are identical.
+    ///
+    inline ServiceIdentifier exitKernel()
+    {
+        if constexpr (ContextSwitcherProvidesFastReturn<Switcher>)
+        {
+            if (this->next == this->prev)
+            {
+                return Switcher::returnToTask(this->next);
+            }
+        }
+
+        // Perform code injections
+        ((Injector{}(this->prev, this->next)), ...);
+
+        return Switcher::switchTask(this->prev, this->next);
+    }
+
+    /// Invoke the kernel entry hook of the given injector if it is implemented
+    template <typename I>
+    inline void onServiceRoutineEnter(const ServiceIdentifier& identifier)
+    {
+        if constexpr (DispatcherCodeInjectorProvidesServiceRoutineHooks<I, Task, ServiceIdentifier>)
+        {
+            I{}.onServiceRoutineEnter(this->prev, identifier);
+        }
+    }
+
+    /// Invoke the service routine exit hook of the given injector if it is implemented
+    template <typename I>
+    inline void onServiceRoutineExit(const ServiceIdentifier& identifier)
+    {
+        if constexpr (DispatcherCodeInjectorProvidesServiceRoutineHooks<I, Task, ServiceIdentifier>)
+        {
+            I{}.onServiceRoutineExit(this->prev, this->next, identifier);
+        }
+    }
+
 public:
     ///
     /// Create a dispatcher with initial tasks
@@ -128,18 +223,26 @@ public:
     {
         while (true)
         {
-            // Perform code injections
-            ((Injector{}(this->prev, this->next)), ...);
-
             // Switch the task and exit the kernel
             // When the function returns, we are back to the kernel
-            ServiceIdentifier identifier = Switcher::switchTask(this->prev, this->next);
+            ServiceIdentifier identifier = this->exitKernel();
 
             // Enter the kernel
             this->prev = this->next;
 
+            (this->onServiceRoutineEnter<Injector>(identifier), ...);
+
             // Invoke the kernel service routine
-            this->next = ServiceRoutineMapper{}(identifier)(this->prev);
+            if constexpr (KernelServiceRoutineMapperProvidesDirectInvocation<ServiceRoutineMapper, ServiceIdentifier>)
+            {
+                this->next = ServiceRoutineMapper::invoke(identifier, this->prev);
+            }
+            else
+            {
+                this->next = ServiceRoutineMapper{}(identifier)(this->prev);
+            }
+
+            (this->onServiceRoutineExit<Injector>(identifier), ...);
         }
     }
 };
@@ -0,0 +1,239 @@
+//
+//  DispatcherProfiler.hpp
+//  Execution
+//
+//  Created by FireWolf on 2026-10-14.
+//
+
+#ifndef Execution_DispatcherProfiler_hpp
+#define Execution_DispatcherProfiler_hpp
+
+#include <Types.hpp>
+#include <atomic>
+#include <concepts>
+#include <type_traits>
+#include "TaskConstraints.hpp"
+#include "CycleCounter.hpp"
+
+///
+/// Statistics of a kernel service routine
+///
+/// @tparam Cycles Specify the type of the cycle count
+///
+template <typename Cycles>
+struct ServiceRoutineStatistics
+{
+    /// The number of invocations
+    UInt32 calls;
+
+    /// The minimum number of cycles spent in the service routine
+    Cycles minCycles;
+
+    /// The maximum number of cycles spent in the service routine
+    Cycles maxCycles;
+
+    /// The total number of cycles spent in the service routine
+    Cycles totalCycles;
+};
+
+///
+/// A dispatcher code injector that profiles kernel service routines and context switches
+///
+/// @tparam Task Specify the type of the task control block that has a unique identifier
+/// @tparam ServiceIdentifier Specify the type of the service identifier; Must be an integral or enumeration type
+/// @tparam Counter Specify the architecture-dependent cycle counter
+/// @tparam NumIdentifiers Specify the number of service identifiers to be profiled
+/// @tparam NumTasks Specify the number of task identifiers to be profiled
+/// @tparam Enabled Pass `false` to compile the profiler down to nothing while keeping the dispatcher definition intact
+/// @note The profiler records the number of invocations and the min/max/total cycles per service identifier,
+///       as well as the number of times each task is switched to run, into fixed-size static tables.
+///       Identifiers that are out of range are not recorded.
+/// @note The dispatcher is the only writer of the tables, so each entry is updated with relaxed atomic loads and stores.
+///       Developers can read the tables from a task or a debugger at any time without locking.
+///       Each individual counter is consistent, but an entry may be updated in the middle of reading it.
+/// @note Cycles spent in the switcher and in other injectors are not attributed to any service routine.
+///
+template <typename Task, typename ServiceIdentifier, CycleCounter Counter, size_t NumIdentifiers, size_t NumTasks, bool Enabled = true>
+requires TaskConstraints::TaskHasUniqueIdentifier<Task> &&
+         (std::is_integral_v<ServiceIdentifier> || std::is_enum_v<ServiceIdentifier>) &&
+         std::atomic<typename Counter::Cycles>::is_always_lock_free &&
+         std::atomic<UInt32>::is_always_lock_free
+struct DispatcherProfiler
+{
+    /// The type of the cycle count
+    using Cycles = typename Counter::Cycles;
+
+private:
+    /// An entry in the table that stores statistics of a service routine
+    struct Entry
+    {
+        std::atomic<UInt32> calls;
+
+        std::atomic<Cycles> minCycles;
+
+        std::atomic<Cycles> maxCycles;
+
+        std::atomic<Cycles> totalCycles;
+    };
+
+    /// Statistics of each service routine
+    static inline Entry routines[NumIdentifiers];
+
+    /// The number of times each task is switched to run
+    static inline std::atomic<UInt32> switches[NumTasks];
+
+    /// The cycle count when the kernel is entered
+    static inline Cycles timestamp;
+
+    /// Private helper to store the given value to the given counter with a single writer
+    template <typename T>
+    static inline void store(std::atomic<T>& counter, T value)
+    {
+        counter.store(value, std::memory_order_relaxed);
+    }
+
+    /// Private helper to load the value from the given counter
+    template <typename T>
+    static inline T load(const std::atomic<T>& counter)
+    {
+        return counter.load(std::memory_order_relaxed);
+    }
+
+public:
+    ///
+    /// [Injector] Record a context switch to the next task
+    ///
+    /// @param prev The task that is interrupted
+    /// @param next The task that is selected to run
+    ///
+    void operator()([[maybe_unused]] Task* prev, Task* next)
+    {
+        if constexpr (Enabled)
+        {
+            auto index = static_cast<size_t>(next->getUniqueIdentifier());
+
+            if (prev != next && index < NumTasks)
+            {
+                store(switches[index], load(switches[index]) + 1);
+            }
+        }
+    }
+
+    ///
+    /// [Injector] Record the cycle count when the kernel is entered
+    ///
+    void onServiceRoutineEnter([[maybe_unused]] Task* task, [[maybe_unused]] const ServiceIdentifier& identifier)
+    {
+        if constexpr (Enabled)
+        {
+            timestamp = Counter::now();
+        }
+    }
+
+    ///
+    /// [Injector] Record the cycles spent in the service routine that services the given identifier
+    ///
+    void onServiceRoutineExit([[maybe_unused]] Task* prev, [[maybe_unused]] Task* next, [[maybe_unused]] const ServiceIdentifier& identifier)
+    {
+        if constexpr (Enabled)
+        {
+            Cycles elapsed = Counter::now() - timestamp;
+
+            auto index = static_cast<size_t>(identifier);
+
+            if (index >= NumIdentifiers)
+            {
+                return;
+            }
+
+            Entry& entry = routines[index];
+
+            UInt32 calls = load(entry.calls);
+
+            if (calls == 0 || elapsed < load(entry.minCycles))
+            {
+                store(entry.minCycles, elapsed);
+            }
+
+            if (elapsed > load(entry.maxCycles))
+            {
+                store(entry.maxCycles, elapsed);
+            }
+
+            store(entry.totalCycles, static_cast<Cycles>(load(entry.totalCycles) + elapsed));
+
+            store(entry.calls, calls + 1);
+        }
+    }
+
+    ///
+    /// Get the statistics of the service routine that services the given identifier
+    ///
+    /// @param identifier The service identifier
+    /// @return A snapshot of the statistics, all zeros if the identifier is out of range or the profiler is disabled.
+    ///
+    static ServiceRoutineStatistics<Cycles> getServiceRoutineStatistics(const ServiceIdentifier& identifier)
+    {
+        if constexpr (Enabled)
+        {
+            auto index = static_cast<size_t>(identifier);
+
+            if (index < NumIdentifiers)
+            {
+                const Entry& entry = routines[index];
+
+                return { load(entry.calls), load(entry.minCycles), load(entry.maxCycles), load(entry.totalCycles) };
+            }
+        }
+
+        return {};
+    }
+
+    ///
+    /// Get the number of times the task with the given identifier is switched to run
+    ///
+    /// @param identifier The task identifier
+    /// @return The number of context switches, zero if the identifier is out of range or the profiler is disabled.
+    ///
+    static UInt32 getContextSwitchCount(size_t identifier)
+    {
+        if constexpr (Enabled)
+        {
+            if (identifier < NumTasks)
+            {
+                return load(switches[identifier]);
+            }
+        }
+
+        return 0;
+    }
+
+    ///
+    /// Reset all statistics
+    ///
+    /// @note This function should be invoked in the kernel, since the dispatcher is the only writer of the tables.
+    ///
+    static void reset()
+    {
+        if constexpr (Enabled)
+        {
+            for (Entry& entry : routines)
+            {
+                store(entry.calls, UInt32{0});
+
+                store(entry.minCycles, Cycles{0});
+
+                store(entry.maxCycles, Cycles{0});
+
+                store(entry.totalCycles, Cycles{0});
+            }
+
+            for (auto& count : switches)
+            {
+                store(count, UInt32{0});
+            }
+        }
+    }
+};
+
+#endif /* Execution_DispatcherProfiler_hpp */
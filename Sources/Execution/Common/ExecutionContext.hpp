@@ -9,6 +9,7 @@
 #define Execution_ExecutionContext_hpp
 
 #include <concepts>
+#include <cstdint>
 #include <Types.hpp>
 
 /// Define the constraint on the execution context to provide system call support
@@ -31,4 +32,33 @@ concept ExecutionContextProvidesSystemCallSupport = requires(Context& context, i
     { context.setSyscallKernelReturnValue(krv) } -> std::same_as<void>;
 };
 
+///
+/// Define the constraint on the execution context to provide system call support with arguments passed in registers
+///
+/// @note The execution context exposes the saved register frame, so the kernel can read each argument by its index at compile time.
+///       It does not rely on `va_list` and thus is free of ABI-dependent walks on the user stack.
+///
+template <typename Context>
+concept ExecutionContextProvidesRegisterArguments = requires(Context& context, int krv)
+{
+    ///
+    /// The execution context must provide read access to the register that stores the system call identifier
+    ///
+    { context.getSyscallIdentifier() } -> std::same_as<UInt32>;
+
+    ///
+    /// The execution context must provide read access to the register that stores the system call argument at the given index
+    ///
+    /// @note Signature:
+    ///       template <size_t Index>
+    ///       uintptr_t getSyscallArgument();
+    ///
+    { context.template getSyscallArgument<0>() } -> std::same_as<uintptr_t>;
+
+    ///
+    /// The execution context must provide write access to the register that stores the kernel return value
+    ///
+    { context.setSyscallKernelReturnValue(krv) } -> std::same_as<void>;
+};
+
 #endif /* Execution_ExecutionContext_hpp */
@@ -0,0 +1,138 @@
+//
+//  ExecutionLog.hpp
+//  Execution
+//
+//  Created by FireWolf on 2026-10-14.
+//
+
+#ifndef Execution_ExecutionLog_hpp
+#define Execution_ExecutionLog_hpp
+
+#include <Types.hpp>
+#include <concepts>
+#include <cstdint>
+#include "TaskConstraints.hpp"
+
+/// Specify the verbosity of log messages emitted by kernel building blocks
+enum class ExecutionLogLevel: UInt32
+{
+    /// Emit nothing
+    None = 0,
+
+    /// Emit errors only
+    Error = 1,
+
+    /// Emit errors and informative messages
+    Info = 2,
+};
+
+///
+/// The default log level
+///
+/// @note Developers can define `EXECUTION_DEFAULT_LOG_LEVEL` to one of the enumerators in `ExecutionLogLevel` to override it.
+///       By default, debug builds emit informative messages, while release builds only emit errors,
+///       so the dispatch path of a release kernel carries no logging code.
+///
+#ifndef EXECUTION_DEFAULT_LOG_LEVEL
+    #ifdef DEBUG
+        #define EXECUTION_DEFAULT_LOG_LEVEL Info
+    #else
+        #define EXECUTION_DEFAULT_LOG_LEVEL Error
+    #endif
+#endif
+
+/// Identifiers of binary trace records emitted by kernel building blocks
+enum class ExecutionTraceEvent: UInt32
+{
+    /// A dedicated stack is allocated; Words: task, stack size
+    StackAllocated = 0,
+
+    /// An event is sent; Words: sender, event handler
+    EventSent = 1,
+
+    /// An event handler has finished; Words: finished task, next task
+    EventHandlerReturned = 2,
+
+    /// The execution context of an event handler is built; Words: previous task, next task
+    EventHandlerContextBuilt = 3,
+
+    /// The dispatcher switches to a different task; Words: previous task, next task
+    ContextSwitched = 4,
+};
+
+///
+/// Specify the constraint of a tracer that records binary trace records
+///
+/// @note A trace record consists of a timestamp, an event identifier and two words,
+///       so it is cheap enough to be emitted in the interrupt context and is formatted offline.
+///
+template <typename Tracer>
+concept ExecutionTracer = requires(ExecutionTraceEvent event, uintptr_t word)
+{
+    ///
+    /// The tracer must implement the static function that records the given event and two words
+    ///
+    { Tracer::record(event, word, word) } -> std::same_as<void>;
+};
+
+/// A tracer that records nothing
+struct NoExecutionTracer
+{
+    static inline void record([[maybe_unused]] ExecutionTraceEvent event, [[maybe_unused]] uintptr_t word0, [[maybe_unused]] uintptr_t word1) {}
+};
+
+///
+/// A compile-time logging policy for kernel building blocks
+///
+/// @tparam Level Specify the verbosity of log messages
+/// @tparam Tracer Specify the tracer that records binary trace records
+/// @note Building blocks guard each log message with `if constexpr`,
+///       so messages below the level do not generate any code, including the formatting and argument marshalling.
+/// @note Trace records are independent of the level.
+///       Pass `ExecutionLogLevel::None` and a tracer to replace log messages with binary records.
+///
+template <ExecutionLogLevel Level, ExecutionTracer Tracer = NoExecutionTracer>
+struct ExecutionLog
+{
+    /// `true` if error messages should be emitted
+    static constexpr bool kError = Level >= ExecutionLogLevel::Error;
+
+    /// `true` if informative messages should be emitted
+    static constexpr bool kInfo = Level >= ExecutionLogLevel::Info;
+
+    ///
+    /// Record a binary trace record
+    ///
+    /// @param event The event identifier
+    /// @param word0 The first word
+    /// @param word1 The second word
+    ///
+    static inline void trace(ExecutionTraceEvent event, uintptr_t word0, uintptr_t word1)
+    {
+        Tracer::record(event, word0, word1);
+    }
+};
+
+/// The default logging policy used by kernel building blocks
+using DefaultExecutionLog = ExecutionLog<ExecutionLogLevel::EXECUTION_DEFAULT_LOG_LEVEL>;
+
+///
+/// Convert the given task to a word stored in a trace record
+///
+/// @param task A non-null task control block
+/// @return The unique identifier of the task if available, the address of the task control block otherwise.
+///
+template <typename Task>
+static inline uintptr_t TraceWord(Task* task)
+{
+    if constexpr (TaskConstraints::TaskHasUniqueIdentifier<Task>)
+    {
+        return static_cast<uintptr_t>(task->getUniqueIdentifier());
+    }
+    else
+    {
+        return reinterpret_cast<uintptr_t>(task);
+    }
+}
+
+#endif /* Execution_ExecutionLog_hpp */
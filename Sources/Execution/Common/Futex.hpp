@@ -0,0 +1,312 @@
+//
+//  Futex.hpp
+//  Execution
+//
+//  Created by FireWolf on 2026-10-14.
+//
+
+#ifndef Execution_Futex_hpp
+#define Execution_Futex_hpp
+
+#include <Types.hpp>
+#include <atomic>
+#include <bit>
+#include <concepts>
+#include <cstdint>
+#include "TaskConstraints.hpp"
+
+/// The type of the word on which tasks wait
+using FutexWord = std::atomic<UInt32>;
+
+///
+/// Specify the constraint of the user-space stubs of the futex system calls
+///
+/// @example Forward to `sysFutexWait()` and `sysFutexWake()` declared by the execution model.
+///
+template <typename Syscalls>
+concept FutexSystemCalls = requires(const FutexWord* address, UInt32 value)
+{
+    ///
+    /// The stubs must implement the static function that waits on the given word if it still holds the expected value
+    ///
+    { Syscalls::wait(address, value) } -> std::same_as<int>;
+
+    ///
+    /// The stubs must implement the static function that wakes up to the given number of tasks waiting on the given word
+    ///
+    { Syscalls::wake(address, value) } -> std::same_as<int>;
+};
+
+///
+/// A mutex whose uncontended operations never enter the kernel
+///
+/// @tparam Syscalls Specify the user-space stubs of the futex system calls
+/// @note The word is 0 if the mutex is unlocked, 1 if it is locked, and 2 if it is locked and may have waiters.
+///       Locking an unlocked mutex and unlocking a mutex without waiters take a single atomic operation,
+///       while contended operations wait and wake in the kernel.
+/// @note The mutex is not recursive and does not implement priority inheritance.
+///
+template <FutexSystemCalls Syscalls>
+struct FutexMutex
+{
+private:
+    FutexWord word = 0;
+
+public:
+    ///
+    /// Try to lock the mutex without waiting
+    ///
+    /// @return `true` if the mutex has been locked by the caller, `false` otherwise.
+    ///
+    bool tryLock()
+    {
+        UInt32 expected = 0;
+
+        return this->word.compare_exchange_strong(expected, 1, std::memory_order_acquire, std::memory_order_relaxed);
+    }
+
+    /// Lock the mutex and wait in the kernel if it is contended
+    void lock()
+    {
+        UInt32 state = 0;
+
+        // Guard: Fast path when the mutex is unlocked
+        if (this->word.compare_exchange_strong(state, 1, std::memory_order_acquire, std::memory_order_relaxed))
+        {
+            return;
+        }
+
+        // Mark the mutex as contended, so the owner wakes a waiter when it unlocks
+        if (state != 2)
+        {
+            state = this->word.exchange(2, std::memory_order_acquire);
+        }
+
+        while (state != 0)
+        {
+            Syscalls::wait(&this->word, 2);
+
+            state = this->word.exchange(2, std::memory_order_acquire);
+        }
+    }
+
+    /// Unlock the mutex and wake a waiter if it is contended
+    void unlock()
+    {
+        // Guard: Fast path when no task waits on the mutex
+        if (this->word.fetch_sub(1, std::memory_order_release) == 1)
+        {
+            return;
+        }
+
+        this->word.store(0, std::memory_order_release);
+
+        Syscalls::wake(&this->word, 1);
+    }
+};
+
+///
+/// A counting semaphore whose uncontended operations never enter the kernel
+///
+/// @tparam Syscalls Specify the user-space stubs of the futex system calls
+/// @note The word holds the number of available units, and a separate counter tracks the number of waiters,
+///       so that releasing a unit enters the kernel only if a task may be waiting for it.
+///
+template <FutexSystemCalls Syscalls>
+struct FutexSemaphore
+{
+private:
+    FutexWord count;
+
+    std::atomic<UInt32> waiters = 0;
+
+public:
+    ///
+    /// Create a semaphore with the given number of units
+    ///
+    /// @param count The initial number of available units
+    ///
+    explicit FutexSemaphore(UInt32 count = 0) : count(count) {}
+
+    ///
+    /// Try to acquire a unit without waiting
+    ///
+    /// @return `true` if a unit has been acquired, `false` if no unit is available.
+    ///
+    bool tryAcquire()
+    {
+        UInt32 available = this->count.load(std::memory_order_relaxed);
+
+        while (available != 0)
+        {
+            if (this->count.compare_exchange_weak(available, available - 1, std::memory_order_acquire, std::memory_order_relaxed))
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    /// Acquire a unit and wait in the kernel if no unit is available
+    void acquire()
+    {
+        // Guard: Fast path when a unit is available
+        if (this->tryAcquire())
+        {
+            return;
+        }
+
+        // Announce the waiter before checking the count again, so a concurrent release cannot miss it
+        this->waiters.fetch_add(1, std::memory_order_seq_cst);
+
+        while (!this->tryAcquire())
+        {
+            Syscalls::wait(&this->count, 0);
+        }
+
+        this->waiters.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    /// Release a unit and wake a waiter if any
+    void release()
+    {
+        this->count.fetch_add(1, std::memory_order_seq_cst);
+
+        // Guard: Fast path when no task waits on the semaphore
+        if (this->waiters.load(std::memory_order_seq_cst) == 0)
+        {
+            return;
+        }
+
+        Syscalls::wake(&this->count, 1);
+    }
+};
+
+///
+/// Per-address queues of tasks that wait on futex words
+///
+/// @tparam Task Specify the type of the task control block that can wait on a futex word
+/// @tparam NumBuckets Specify the number of buckets; Must be a power of two
+/// @note Addresses are hashed to buckets, each of which is an intrusive first-in-first-out list linked by task control blocks,
+///       so waiting takes constant time and never allocates memory, and waking walks only the bucket of the address.
+/// @note The queues are a collection of static functions and variables and assume that they are accessed in the kernel
+///       with interrupts disabled on a single core. A multi-core kernel must guard each bucket with a lock.
+///
+template <typename Task, size_t NumBuckets = 32>
+requires TaskConstraints::TaskCanWaitOnFutex<Task> && (std::has_single_bit(NumBuckets))
+struct FutexWaitQueues
+{
+private:
+    /// A bucket of waiting tasks
+    struct Bucket
+    {
+        Task* head = nullptr;
+
+        Task* tail = nullptr;
+    };
+
+    /// Buckets indexed by the hash of the address
+    static inline Bucket buckets[NumBuckets];
+
+    /// Private helper to get the bucket of the given address
+    static Bucket& bucketOf(const FutexWord* address)
+    {
+        // Fibonacci hashing spreads nearby words to different buckets
+        auto hash = static_cast<UInt64>(reinterpret_cast<uintptr_t>(address) / alignof(FutexWord)) * UINT64_C(0x9E3779B97F4A7C15);
+
+        return buckets[static_cast<size_t>(hash >> 32) & (NumBuckets - 1)];
+    }
+
+public:
+    ///
+    /// Enqueue the given task to the queue of the given address
+    ///
+    /// @param task A non-null task control block that is not waiting
+    /// @param address The address of the futex word
+    ///
+    static void enqueue(Task* task, const FutexWord* address)
+    {
+        Bucket& bucket = bucketOf(address);
+
+        task->setFutexAddress(address);
+
+        task->setNextFutexWaiter(nullptr);
+
+        if (bucket.tail == nullptr)
+        {
+            bucket.head = task;
+        }
+        else
+        {
+            bucket.tail->setNextFutexWaiter(task);
+        }
+
+        bucket.tail = task;
+    }
+
+    ///
+    /// Dequeue up to the given number of tasks that wait on the given address
+    ///
+    /// @param address The address of the futex word
+    /// @param count The maximum number of tasks to dequeue
+    /// @param handler A functor that consumes each dequeued task, in the order in which the tasks started waiting
+    /// @return The number of dequeued tasks.
+    ///
+    template <typename Handler>
+    requires std::invocable<Handler&, Task*>
+    static size_t dequeue(const FutexWord* address, size_t count, Handler&& handler)
+    {
+        Bucket& bucket = bucketOf(address);
+
+        size_t dequeued = 0;
+
+        Task* prev = nullptr;
+
+        Task* task = bucket.head;
+
+        while (task != nullptr && dequeued < count)
+        {
+            Task* next = task->getNextFutexWaiter();
+
+            // Guard: The task waits on another address that shares the bucket
+            if (task->getFutexAddress() != address)
+            {
+                prev = task;
+
+                task = next;
+
+                continue;
+            }
+
+            // Unlink the task
+            if (prev == nullptr)
+            {
+                bucket.head = next;
+            }
+            else
+            {
+                prev->setNextFutexWaiter(next);
+            }
+
+            if (bucket.tail == task)
+            {
+                bucket.tail = prev;
+            }
+
+            task->setFutexAddress(nullptr);
+
+            task->setNextFutexWaiter(nullptr);
+
+            handler(task);
+
+            dequeued += 1;
+
+            task = next;
+        }
+
+        return dequeued;
+    }
+};
+
+#endif /* Execution_Futex_hpp */
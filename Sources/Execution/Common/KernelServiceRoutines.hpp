@@ -9,6 +9,8 @@
 #define Execution_CommonKernelServiceRoutines_hpp
 
 #include <Debug.hpp>
+#include "PerCore.hpp"
+#include "TaskConstraints.hpp"
 
 /// Declare a global task scheduler with the given type and name
 #define OSDeclareTaskScheduler(type, name) \
@@ -44,6 +46,52 @@ namespace KernelServiceRoutines                                     \
     }                                                               \
 }
 
+/// Declare a per-core array of task schedulers with the given type, name and core identifier provider
+#define OSDeclarePerCoreTaskScheduler(type, name, provider) \
+static PerCoreStorage<type, provider> name;
+
+/// Declare a per-core array of task schedulers with the given type, name and core identifier provider
+/// as well as the kernel service routines that retrieve the scheduler owned by the current core or by the given core
+#define OSDeclarePerCoreTaskSchedulerWithKernelServiceRoutine(type, name, provider) \
+OSDeclarePerCoreTaskScheduler(type, name, provider)                                 \
+namespace KernelServiceRoutines                                                     \
+{                                                                                   \
+    template <typename S>                                                           \
+    S& GetTaskScheduler()                                                           \
+    {                                                                               \
+        return name.current();                                                      \
+    }                                                                               \
+                                                                                    \
+    template <typename S>                                                           \
+    S& GetTaskSchedulerOnCore(size_t core)                                          \
+    {                                                                               \
+        return name[core];                                                          \
+    }                                                                               \
+}
+
+/// Declare a per-core array of task controllers with the given type, name and core identifier provider
+#define OSDeclarePerCoreTaskController(type, name, provider) \
+static PerCoreStorage<type, provider> name;
+
+/// Declare a per-core array of task controllers with the given type, name and core identifier provider
+/// as well as the kernel service routines that retrieve the controller owned by the current core or by the given core
+#define OSDeclarePerCoreTaskControllerWithKernelServiceRoutine(type, name, provider) \
+OSDeclarePerCoreTaskController(type, name, provider)                                 \
+namespace KernelServiceRoutines                                                      \
+{                                                                                    \
+    template <typename C>                                                            \
+    C& GetTaskController()                                                           \
+    {                                                                                \
+        return name.current();                                                       \
+    }                                                                                \
+                                                                                     \
+    template <typename C>                                                            \
+    C& GetTaskControllerOnCore(size_t core)                                          \
+    {                                                                                \
+        return name[core];                                                           \
+    }                                                                                \
+}
+
 /// Declare the shared stack pointer for all tasks as well as the kernel service routine to access it
 #define OSDeclareSharedTaskStackPointer(name) \
 static UInt8* name;                           \
@@ -67,6 +115,7 @@ namespace KernelServiceRoutines
     ///       Kernel service routines rely on this function to reschedule tasks if necessary.
     ///       The implementation can be as simple as returning the global scheduler variable on a single-core system,
     ///       or returning the scheduler attached to the current interrupted processor on a multi-core system.
+    /// @see `OSDeclarePerCoreTaskSchedulerWithKernelServiceRoutine` for the implementation on a multi-core system.
     ///
     template <typename S>
     S& GetTaskScheduler();
@@ -83,6 +132,33 @@ namespace KernelServiceRoutines
     template <typename C>
     C& GetTaskController();
 
+    ///
+    /// Get the task scheduler owned by the given core
+    ///
+    /// @tparam S Specify the type of the task scheduler
+    /// @param core The core identifier
+    /// @return The task scheduler owned by the given core.
+    /// @note This function must be implemented by kernel developers on a multi-core system,
+    ///       if kernel service routines need to access the scheduler of another core.
+    ///       The implementation can be as simple as indexing the per-core scheduler array.
+    /// @see `OSDeclarePerCoreTaskSchedulerWithKernelServiceRoutine`.
+    ///
+    template <typename S>
+    S& GetTaskSchedulerOnCore(size_t core);
+
+    ///
+    /// Get the task controller owned by the given core
+    ///
+    /// @tparam C Specify the type of the task controller
+    /// @param core The core identifier
+    /// @return The task controller owned by the given core.
+    /// @note This function must be implemented by kernel developers on a multi-core system,
+    ///       if kernel service routines need to access the controller of another core.
+    /// @see `OSDeclarePerCoreTaskControllerWithKernelServiceRoutine`.
+    ///
+    template <typename C>
+    C& GetTaskControllerOnCore(size_t core);
+
     ///
     /// Get the current shared stack pointer for all tasks
     ///
@@ -107,6 +183,140 @@ namespace KernelServiceRoutines
         { controller.release(task) } -> std::same_as<void>;
     };
 
+    ///
+    /// Specify the constraint of a scheduler that can be notified of multiple new tasks at once
+    ///
+    /// @note The scheduler enqueues all given tasks first and selects the next task only once,
+    ///       rather than comparing the running task with each new task in turn.
+    ///
+    template <typename TaskScheduler, typename Task>
+    concept SchedulerProvidesBatchTaskCreationHandler = requires(TaskScheduler& scheduler, Task* current, Task** tasks, size_t count)
+    {
+        { scheduler.onTasksCreated(current, tasks, count) } -> std::same_as<Task*>;
+    };
+
+    ///
+    /// Specify the constraint of a stateless adapter that intercepts the creation of new tasks
+    ///
+    /// @note An adapter, e.g. `WorkStealingBalancer` or `EventPreemptionLock`, can be passed as the task scheduler of service routines
+    ///       to decide where and when a new task is admitted to the global scheduler.
+    ///
+    template <typename Adapter, typename Task>
+    concept TaskCreationAdapter = requires(Task* current, Task* task)
+    {
+        { Adapter::onTaskCreated(current, task) } -> std::same_as<Task*>;
+    };
+
+    ///
+    /// Notify the scheduler or the adapter that a new task has been created
+    ///
+    /// @tparam TaskScheduler Specify the type of a task scheduler or a stateless adapter
+    /// @param current The current running task
+    /// @param task The newly created task
+    /// @return The next task that is selected to run.
+    ///
+    template <typename TaskScheduler, typename Task>
+    static inline Task* NotifyTaskCreated(Task* current, Task* task)
+    {
+        if constexpr (TaskCreationAdapter<TaskScheduler, Task>)
+        {
+            return TaskScheduler::onTaskCreated(current, task);
+        }
+        else
+        {
+            return GetTaskScheduler<TaskScheduler>().onTaskCreated(current, task);
+        }
+    }
+
+    ///
+    /// Notify the scheduler or the adapter that multiple new tasks have been created
+    ///
+    /// @tparam TaskScheduler Specify the type of a task scheduler or a stateless adapter
+    /// @param current The current running task
+    /// @param tasks A non-null array of newly created tasks
+    /// @param count The number of tasks in the array
+    /// @return The next task that is selected to run.
+    /// @note Tasks are handed over in one call if the scheduler or the adapter satisfies `SchedulerProvidesBatchTaskCreationHandler`.
+    ///       Otherwise, each task is handed over in turn, while the previously selected task is considered as the running one.
+    ///
+    template <typename TaskScheduler, typename Task>
+    static inline Task* NotifyTasksCreated(Task* current, Task** tasks, size_t count)
+    {
+        if constexpr (SchedulerProvidesBatchTaskCreationHandler<TaskScheduler, Task> && TaskCreationAdapter<TaskScheduler, Task>)
+        {
+            return TaskScheduler::onTasksCreated(current, tasks, count);
+        }
+        else if constexpr (SchedulerProvidesBatchTaskCreationHandler<TaskScheduler, Task>)
+        {
+            return GetTaskScheduler<TaskScheduler>().onTasksCreated(current, tasks, count);
+        }
+        else
+        {
+            for (size_t index = 0; index < count; index += 1)
+            {
+                current = NotifyTaskCreated<TaskScheduler>(current, tasks[index]);
+            }
+
+            return current;
+        }
+    }
+
+    ///
+    /// Specify the constraint of a stateless adapter that intercepts the termination of the current task
+    ///
+    /// @note An adapter, e.g. `WorkStealingBalancer`, can be passed as the task scheduler of service routines
+    ///       that remove the current task from the scheduler because it has finished or blocked.
+    ///
+    template <typename Adapter, typename Task>
+    concept TaskTerminationAdapter = requires(Task* task)
+    {
+        { Adapter::onTaskFinished(task) } -> std::same_as<Task*>;
+    };
+
+    ///
+    /// Notify the scheduler or the adapter that the current task has finished or blocked
+    ///
+    /// @tparam TaskScheduler Specify the type of a task scheduler or a stateless adapter
+    /// @param task The current running task that leaves the processor
+    /// @return The next task that is selected to run.
+    ///
+    template <typename TaskScheduler, typename Task>
+    static inline Task* NotifyTaskFinished(Task* task)
+    {
+        if constexpr (TaskTerminationAdapter<TaskScheduler, Task>)
+        {
+            return TaskScheduler::onTaskFinished(task);
+        }
+        else
+        {
+            return GetTaskScheduler<TaskScheduler>().onTaskFinished(task);
+        }
+    }
+
+    ///
+    /// Fetch the system call argument at the given index
+    ///
+    /// @tparam Arg Specify the type of the argument
+    /// @tparam Index Specify the index of the argument
+    /// @param task The task that invokes the system call
+    /// @return The argument read from registers if the task provides indexed access, or the next sequential argument otherwise.
+    /// @note Sequential access is stateful, so callers must fetch arguments in the order of their indices.
+    ///
+    template <typename Arg, size_t Index, typename Task>
+    requires TaskConstraints::TaskProvidesSequentialSyscallArgumentsAccess<Task> ||
+             TaskConstraints::TaskProvidesIndexedSyscallArgumentsAccess<Task>
+    static inline Arg FetchSyscallArgument(Task* task)
+    {
+        if constexpr (TaskConstraints::TaskProvidesIndexedSyscallArgumentsAccess<Task>)
+        {
+            return task->template getSyscallArgument<Arg, Index>();
+        }
+        else
+        {
+            return task->template getSyscallArgument<Arg>();
+        }
+    }
+
     ///
     /// Kernel service routine to report an error when the service identifier cannot be recognized
     ///
@@ -0,0 +1,192 @@
+//
+//  LazyFPUContext.hpp
+//  Execution
+//
+//  Created by FireWolf on 2026-10-14.
+//
+
+#ifndef Execution_LazyFPUContext_hpp
+#define Execution_LazyFPUContext_hpp
+
+#include <Types.hpp>
+#include <Debug.hpp>
+#include <concepts>
+#include "ExecutionLog.hpp"
+#include "TaskConstraints.hpp"
+
+///
+/// Specify the constraint of the architecture-dependent controller of the floating-point and vector unit
+///
+/// @note e.g. Toggle `CPACR.FPEN` on ARMv8-A, `CPACR.CP10/CP11` on Cortex-M or `CR0.TS` on x86,
+///       and save or restore the register bank with `STP/LDP`, `VSTM/VLDM` or `FXSAVE/FXRSTOR`.
+///
+template <typename FPU>
+concept FPUContextController = requires(typename FPU::State* state)
+{
+    ///
+    /// The controller must specify the type of the saved register bank
+    ///
+    typename FPU::State;
+
+    ///
+    /// The controller must implement the static function that grants access to the unit
+    ///
+    { FPU::enable() } -> std::same_as<void>;
+
+    ///
+    /// The controller must implement the static function that revokes access to the unit,
+    /// so the next instruction that uses the unit traps into the kernel
+    ///
+    { FPU::disable() } -> std::same_as<void>;
+
+    ///
+    /// The controller must implement the static functions that save and restore the register bank
+    ///
+    /// @note The unit must be enabled when these functions are invoked.
+    ///
+    { FPU::save(state) } -> std::same_as<void>;
+    { FPU::restore(state) } -> std::same_as<void>;
+
+    ///
+    /// The controller must implement the static function that resets the register bank for a task that uses the unit for the first time
+    ///
+    { FPU::reset() } -> std::same_as<void>;
+};
+
+///
+/// A code injector for the dispatcher to switch the floating-point and vector context lazily
+///
+/// @tparam Task Specify the type of the task control block that has a floating-point context
+/// @tparam FPU Specify the architecture-dependent controller of the unit
+/// @note The register bank stays in the unit until another task uses it, so a context switch never saves or restores it.
+///       Instead, this injector grants access to the unit only if the next task owns the register bank,
+///       and any other task traps on its first use of the unit, which is serviced by `LazyFPUContextSwitch`.
+///       Tasks that never use the unit pay a single register write per context switch.
+/// @note The owner is a global state of the unit, so this injector is designed for a single-core system.
+///       On a multi-core system, a migrated task could find its register bank live on another core.
+///
+template <typename Task, FPUContextController FPU>
+requires TaskConstraints::TaskHasFPUContext<Task> &&
+         std::same_as<typename Task::FPUStateType, typename FPU::State>
+struct LazyFPUContextInjector
+{
+private:
+    /// The task whose register bank currently resides in the unit
+    static inline Task* owner = nullptr;
+
+public:
+    ///
+    /// [Injector] Grant access to the unit if and only if the next task owns the register bank
+    ///
+    /// @param prev The task that is interrupted
+    /// @param next The task that is selected to run
+    ///
+    void operator()([[maybe_unused]] Task* prev, Task* next)
+    {
+        if (next == owner)
+        {
+            FPU::enable();
+        }
+        else
+        {
+            FPU::disable();
+        }
+    }
+
+    ///
+    /// Get the task whose register bank currently resides in the unit
+    ///
+    /// @return The owner of the unit, `nullptr` if no task owns it.
+    ///
+    static Task* getOwner()
+    {
+        return owner;
+    }
+
+    ///
+    /// Transfer the ownership of the unit to the given task
+    ///
+    /// @param task The task that traps on the use of the unit
+    /// @return `true` if the register bank has been switched, `false` if the task already owns the unit.
+    /// @note The previous owner's register bank is saved to its control block,
+    ///       and the given task's register bank is restored, or reset if the task uses the unit for the first time.
+    ///
+    static bool acquire(Task* task)
+    {
+        FPU::enable();
+
+        // Guard: The task already owns the unit, e.g. the access was revoked by an outdated context switch
+        if (owner == task)
+        {
+            return false;
+        }
+
+        if (owner != nullptr)
+        {
+            FPU::save(owner->getFPUState());
+        }
+
+        if (task->hasFPUState())
+        {
+            FPU::restore(task->getFPUState());
+        }
+        else
+        {
+            FPU::reset();
+
+            task->setHasFPUState(true);
+        }
+
+        owner = task;
+
+        return true;
+    }
+
+    ///
+    /// Give up the ownership of the unit if the given task owns it
+    ///
+    /// @param task A task that is about to be released
+    /// @note The register bank of a finished task is discarded without being saved.
+    ///
+    static void forget(Task* task)
+    {
+        if (owner == task)
+        {
+            owner = nullptr;
+        }
+
+        task->setHasFPUState(false);
+    }
+};
+
+/// Defines kernel service routines for the lazy floating-point context switch
+namespace KernelServiceRoutines
+{
+    ///
+    /// Kernel service routine to handle the trap raised by the first use of the floating-point and vector unit
+    ///
+    /// @tparam Task Specify the type of the task control block that has a floating-point context
+    /// @tparam Injector Specify the lazy context injector, i.e. `LazyFPUContextInjector`
+    /// @tparam Log Specify the logging policy
+    /// @note The dispatcher routes the undefined instruction or the coprocessor trap to this routine.
+    ///       The routine transfers the unit to the interrupted task, which then re-executes the trapped instruction.
+    ///
+    template <typename Task, typename Injector, typename Log = DefaultExecutionLog>
+    struct LazyFPUContextSwitch
+    {
+        Task* operator()(Task* task)
+        {
+            if (Injector::acquire(task))
+            {
+                if constexpr (Log::kInfo)
+                {
+                    pinfo("Task at 0x%p has acquired the floating-point unit.", task);
+                }
+            }
+
+            return task;
+        }
+    };
+}
+
+#endif /* Execution_LazyFPUContext_hpp */
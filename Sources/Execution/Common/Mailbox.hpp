@@ -0,0 +1,182 @@
+//
+//  Mailbox.hpp
+//  Execution
+//
+//  Created by FireWolf on 2026-10-14.
+//
+
+#ifndef Execution_Mailbox_hpp
+#define Execution_Mailbox_hpp
+
+#include <Types.hpp>
+#include <atomic>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <type_traits>
+
+/// The result of posting a message to a mailbox
+enum class MailboxPostResult
+{
+    /// The mailbox is full and the message is dropped
+    Full,
+
+    /// The message is posted to a mailbox that has pending messages
+    Posted,
+
+    /// The message is posted to an empty mailbox, so the sender must notify the receiver
+    PostedToEmptyMailbox,
+};
+
+///
+/// A bounded lock-free mailbox that has multiple producers and a single consumer
+///
+/// @tparam Message Specify the type of the message; Must be trivially copyable
+/// @tparam Capacity Specify the maximum number of pending messages; Must be a power of two
+/// @note Each slot carries a sequence number, so producers on different cores claim slots with a single CAS
+///       and the consumer never blocks producers while it drains the mailbox.
+/// @note The mailbox also counts pending messages, so that only the producer that makes the mailbox non-empty
+///       is asked to notify the receiver, e.g. by raising an inter-processor interrupt.
+///       The consumer keeps draining until the count drops to zero, so no message is left behind without a notification.
+///
+template <typename Message, size_t Capacity>
+requires std::is_trivially_copyable_v<Message> && (std::has_single_bit(Capacity))
+struct MPSCMailbox
+{
+private:
+    /// A slot in the mailbox
+    struct Slot
+    {
+        std::atomic<size_t> sequence;
+
+        Message message;
+    };
+
+    /// Slots in the mailbox
+    Slot slots[Capacity];
+
+    /// The position of the next slot to be claimed by producers
+    std::atomic<size_t> tail;
+
+    /// The position of the next slot to be consumed by the consumer
+    size_t head;
+
+    /// The number of messages that have been posted but not acknowledged by the consumer
+    std::atomic<size_t> pending;
+
+    /// [Consumer] Private helper to pop a published message
+    bool pop(Message& message)
+    {
+        Slot& slot = this->slots[this->head & (Capacity - 1)];
+
+        // Guard: The slot has not been published yet
+        if (slot.sequence.load(std::memory_order_acquire) != this->head + 1)
+        {
+            return false;
+        }
+
+        message = slot.message;
+
+        // Hand the slot back to producers for the next lap
+        slot.sequence.store(this->head + Capacity, std::memory_order_release);
+
+        this->head += 1;
+
+        return true;
+    }
+
+public:
+    /// Create an empty mailbox
+    MPSCMailbox() : tail(0), head(0), pending(0)
+    {
+        for (size_t index = 0; index < Capacity; index += 1)
+        {
+            this->slots[index].sequence.store(index, std::memory_order_relaxed);
+        }
+    }
+
+    ///
+    /// [Producer] Post a message to the mailbox
+    ///
+    /// @param message The message
+    /// @return The result of posting the message.
+    ///
+    MailboxPostResult post(const Message& message)
+    {
+        size_t position = this->tail.load(std::memory_order_relaxed);
+
+        while (true)
+        {
+            Slot& slot = this->slots[position & (Capacity - 1)];
+
+            auto difference = static_cast<ptrdiff_t>(slot.sequence.load(std::memory_order_acquire) - position);
+
+            // Guard: The consumer has not released the slot since the last lap
+            if (difference < 0)
+            {
+                return MailboxPostResult::Full;
+            }
+
+            // Another producer has claimed the slot; Retry with the latest position
+            if (difference > 0)
+            {
+                position = this->tail.load(std::memory_order_relaxed);
+
+                continue;
+            }
+
+            // Claim the slot
+            if (this->tail.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+            {
+                slot.message = message;
+
+                slot.sequence.store(position + 1, std::memory_order_release);
+
+                break;
+            }
+        }
+
+        return this->pending.fetch_add(1, std::memory_order_acq_rel) == 0 ? MailboxPostResult::PostedToEmptyMailbox : MailboxPostResult::Posted;
+    }
+
+    ///
+    /// [Consumer] Drain all pending messages
+    ///
+    /// @param handler A functor that consumes each message in order
+    /// @return The number of messages drained.
+    /// @note A producer may publish a message before counting it,
+    ///       in which case the consumer waits for the count to catch up before it returns.
+    ///       Producers run in the kernel with interrupts disabled, so the window is a few instructions.
+    ///
+    template <typename Handler>
+    requires std::invocable<Handler&, const Message&>
+    size_t drain(Handler&& handler)
+    {
+        size_t total = 0;
+
+        while (true)
+        {
+            size_t drained = 0;
+
+            Message message;
+
+            while (this->pop(message))
+            {
+                handler(message);
+
+                drained += 1;
+            }
+
+            total += drained;
+
+            // Acknowledge drained messages
+            // Messages posted in the meantime did not notify the consumer, so keep draining them
+            if (this->pending.fetch_sub(drained, std::memory_order_acq_rel) == drained)
+            {
+                return total;
+            }
+        }
+    }
+};
+
+#endif /* Execution_Mailbox_hpp */
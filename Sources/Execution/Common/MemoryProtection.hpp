@@ -0,0 +1,125 @@
+//
+//  MemoryProtection.hpp
+//  Execution
+//
+//  Created by FireWolf on 2026-10-14.
+//
+
+#ifndef Execution_MemoryProtection_hpp
+#define Execution_MemoryProtection_hpp
+
+#include <Types.hpp>
+#include <concepts>
+#include <cstddef>
+#include "TaskConstraints.hpp"
+
+///
+/// Specify the constraint of the architecture-dependent controller of the memory protection unit
+///
+/// @note The controller reserves `kNumTaskRegions` hardware regions for the running task,
+///       while regions shared by all tasks, e.g. the kernel image and peripherals, are programmed once at boot time and never touched.
+/// @example On ARMv7-M, a region descriptor is the pair of `MPU_RBAR` and `MPU_RASR`.
+///          `describe()` rounds the stack up to a naturally aligned power of two and disables subregions outside the stack,
+///          and `program()` writes the descriptor to the reserved region number `kFirstTaskRegion + index`.
+///
+template <typename MPU>
+concept MemoryProtectionController = requires(const UInt8* stack, size_t size, typename MPU::Region* regions, const typename MPU::Region& region, size_t index)
+{
+    ///
+    /// The controller must specify the type of a region descriptor
+    ///
+    /// @note A default constructed descriptor must describe a disabled region.
+    ///
+    typename MPU::Region;
+
+    requires std::default_initializable<typename MPU::Region>;
+
+    requires std::equality_comparable<typename MPU::Region>;
+
+    ///
+    /// The controller must specify the number of regions reserved for the running task
+    ///
+    { MPU::kNumTaskRegions } -> std::convertible_to<size_t>;
+
+    requires MPU::kNumTaskRegions > 0;
+
+    ///
+    /// The controller must implement the static function that computes the descriptors that grant access to the given stack
+    ///
+    /// @note The function writes exactly `kNumTaskRegions` descriptors and leaves unused ones disabled.
+    ///
+    { MPU::describe(stack, size, regions) } -> std::same_as<void>;
+
+    ///
+    /// The controller must implement the static function that programs a descriptor to the reserved region at the given index
+    ///
+    { MPU::program(index, region) } -> std::same_as<void>;
+};
+
+///
+/// A code injector for the dispatcher to reconfigure the memory protection unit for the next task
+///
+/// @tparam Task Specify the type of the task control block that has memory protection regions
+/// @tparam MPU Specify the architecture-dependent controller of the unit
+/// @note Each task carries the descriptors precomputed when its dedicated stack is assigned or allocated,
+///       so a context switch never computes a descriptor.
+///       This injector keeps a copy of the descriptors currently programmed to the unit,
+///       and rewrites only the regions whose descriptors are different from those of the next task.
+///       Switching between tasks that share regions, or back to the same task, does not touch the unit.
+/// @note Tasks whose stacks are not assigned by the kernel, e.g. the idle task, have all task regions disabled,
+///       and thus can only access memory granted by the regions shared by all tasks.
+/// @note The programmed descriptors are a global state of the unit, so this injector is designed for a single-core system.
+///
+template <typename Task, MemoryProtectionController MPU>
+requires TaskConstraints::TaskHasMemoryProtectionRegions<Task> &&
+         std::same_as<typename Task::MemoryRegionType, typename MPU::Region> &&
+         (Task::kNumMemoryRegions == MPU::kNumTaskRegions)
+struct MemoryProtectionInjector
+{
+private:
+    /// Descriptors currently programmed to the regions reserved for the running task
+    static inline typename MPU::Region programmed[MPU::kNumTaskRegions] = {};
+
+public:
+    ///
+    /// [Injector] Program regions of the next task that are different from the current ones
+    ///
+    /// @param prev The task that is interrupted
+    /// @param next The task that is selected to run
+    ///
+    void operator()([[maybe_unused]] Task* prev, Task* next)
+    {
+        const typename MPU::Region* regions = next->getMemoryRegions();
+
+        for (size_t index = 0; index < MPU::kNumTaskRegions; index += 1)
+        {
+            // Guard: The region is already programmed
+            if (regions[index] == programmed[index])
+            {
+                continue;
+            }
+
+            MPU::program(index, regions[index]);
+
+            programmed[index] = regions[index];
+        }
+    }
+
+    ///
+    /// Disable all regions reserved for the running task
+    ///
+    /// @note The kernel must invoke this function at boot time before the first task runs,
+    ///       or after it reprograms the unit by other means, so that the copy of programmed descriptors is in sync with the unit.
+    ///
+    static void reset()
+    {
+        for (size_t index = 0; index < MPU::kNumTaskRegions; index += 1)
+        {
+            programmed[index] = {};
+
+            MPU::program(index, programmed[index]);
+        }
+    }
+};
+
+#endif /* Execution_MemoryProtection_hpp */
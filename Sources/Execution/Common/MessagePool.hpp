@@ -0,0 +1,169 @@
+//
+//  MessagePool.hpp
+//  Execution
+//
+//  Created by FireWolf on 2026-10-14.
+//
+
+#ifndef Execution_MessagePool_hpp
+#define Execution_MessagePool_hpp
+
+#include <Types.hpp>
+#include <Debug.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+///
+/// A pool of fixed-size message slots owned by the kernel
+///
+/// @tparam Message Specify the type of the message; Must be trivially copyable and trivially default constructible
+/// @tparam Count Specify the number of slots in the pool
+/// @note A slot goes through three states: free, allocated to a sender that fills it in place,
+///       and submitted to the kernel that hands it to the receiver without copying.
+///       The kernel validates every transition, so a slot passed from the user space
+///       cannot be submitted twice or released while it is still free.
+/// @note Both allocation and release take constant time.
+///       The pool threads an intrusive free list through released slots, and
+///       slots that have never been allocated are handed out in order, so the pool needs no initialization pass.
+/// @note The pool is a collection of static functions and variables,
+///       so all users that specify the same template arguments share the same slots.
+/// @note The pool assumes that it is accessed in the kernel with interrupts disabled.
+///
+template <typename Message, size_t Count>
+requires (Count > 0) && std::is_trivially_copyable_v<Message> && std::is_trivially_default_constructible_v<Message>
+struct StaticMessagePool
+{
+private:
+    /// A slot in the pool
+    union Slot
+    {
+        /// The next free slot if this slot is free
+        Slot* next;
+
+        /// The message if this slot is in use
+        Message message;
+    };
+
+    /// The state of a slot
+    enum class SlotState: UInt8
+    {
+        Free = 0,
+
+        Allocated = 1,
+
+        Submitted = 2,
+    };
+
+    /// Statically reserved slots
+    static inline Slot slots[Count];
+
+    /// The state of each slot
+    static inline SlotState states[Count] = {};
+
+    /// The list of slots that have been released to the pool
+    static inline Slot* freeList = nullptr;
+
+    /// The number of slots that have never been allocated
+    static inline size_t numFreshSlots = Count;
+
+    ///
+    /// Private helper to get the index of the given slot
+    ///
+    /// @param message The address of a message that belongs to the pool
+    /// @return The index of the slot.
+    ///
+    static inline size_t indexOf(const Message* message)
+    {
+        return reinterpret_cast<const Slot*>(message) - slots;
+    }
+
+public:
+    ///
+    /// Allocate a slot from the pool
+    ///
+    /// @return The address of the message in the slot on success, `nullptr` if the pool is exhausted.
+    /// @note The content of the message is unspecified.
+    ///
+    static Message* allocate()
+    {
+        Slot* slot = nullptr;
+
+        // Prefer a recycled slot
+        if (freeList != nullptr)
+        {
+            slot = freeList;
+
+            freeList = slot->next;
+        }
+        else if (numFreshSlots != 0)
+        {
+            slot = &slots[Count - numFreshSlots--];
+        }
+        else
+        {
+            return nullptr;
+        }
+
+        states[slot - slots] = SlotState::Allocated;
+
+        return &slot->message;
+    }
+
+    ///
+    /// Submit an allocated message to the kernel
+    ///
+    /// @param message The address of a message returned by `allocate()`
+    /// @return `true` on success, `false` if the message does not belong to the pool or has not been allocated.
+    /// @note The sender must not modify the message after it has been submitted.
+    ///
+    static bool submit(const Message* message)
+    {
+        // Guard: The message must have been allocated but not submitted yet
+        if (!contains(message) || states[indexOf(message)] != SlotState::Allocated)
+        {
+            return false;
+        }
+
+        states[indexOf(message)] = SlotState::Submitted;
+
+        return true;
+    }
+
+    ///
+    /// Release a message back to the pool
+    ///
+    /// @param message The address of a message returned by `allocate()`
+    ///
+    static void release(Message* message)
+    {
+        precondition(contains(message), "The given message does not belong to the pool.");
+
+        precondition(states[indexOf(message)] != SlotState::Free, "The given message has already been released.");
+
+        states[indexOf(message)] = SlotState::Free;
+
+        Slot* slot = reinterpret_cast<Slot*>(message);
+
+        slot->next = freeList;
+
+        freeList = slot;
+    }
+
+    ///
+    /// Check whether the given message belongs to the pool
+    ///
+    /// @param message The address of a message
+    /// @return `true` if the message is the start address of a slot in the pool, `false` otherwise.
+    ///
+    static bool contains(const void* message)
+    {
+        auto address = reinterpret_cast<uintptr_t>(message);
+
+        auto start = reinterpret_cast<uintptr_t>(&slots[0]);
+
+        return address >= start && address < start + sizeof(slots) && (address - start) % sizeof(Slot) == 0;
+    }
+};
+
+#endif /* Execution_MessagePool_hpp */
@@ -0,0 +1,85 @@
+//
+//  PerCore.hpp
+//  Execution
+//
+//  Created by FireWolf on 2026-10-14.
+//
+
+#ifndef Execution_PerCore_hpp
+#define Execution_PerCore_hpp
+
+#include <Types.hpp>
+#include <concepts>
+#include <cstddef>
+
+///
+/// Specify the constraint of the architecture-dependent provider of the current core identifier
+///
+/// @example Read `MPIDR` on ARM or the local APIC identifier on x86, and map it to `[0, kNumCores)`.
+///
+template <typename Provider>
+concept CoreIdentifierProvider = requires
+{
+    ///
+    /// The provider must specify the number of cores on the system
+    ///
+    { Provider::kNumCores } -> std::convertible_to<size_t>;
+
+    requires Provider::kNumCores > 0;
+
+    ///
+    /// The provider must implement the static function that returns the identifier of the current core
+    ///
+    /// @note The identifier must be in the range `[0, kNumCores)`.
+    ///
+    { Provider::getCurrentCoreIdentifier() } -> std::same_as<size_t>;
+};
+
+///
+/// A per-core array of objects, each of which resides in its own cache line
+///
+/// @tparam T Specify the type of the object owned by each core
+/// @tparam Provider Specify the provider of the current core identifier
+/// @tparam Alignment Specify the alignment of each object, typically the size of a cache line
+/// @note Each object is padded to the alignment, so cores that update their own objects never share a cache line.
+///
+template <typename T, CoreIdentifierProvider Provider, size_t Alignment = 64>
+struct PerCoreStorage
+{
+private:
+    /// An object owned by a core
+    struct alignas(Alignment) Slot
+    {
+        T value;
+    };
+
+    /// Objects indexed by the core identifier
+    Slot slots[Provider::kNumCores];
+
+public:
+    /// The number of cores on the system
+    static constexpr size_t kNumCores = Provider::kNumCores;
+
+    ///
+    /// Get the object owned by the current core
+    ///
+    /// @return A reference to the object owned by the current core.
+    ///
+    T& current()
+    {
+        return this->slots[Provider::getCurrentCoreIdentifier()].value;
+    }
+
+    ///
+    /// Get the object owned by the given core
+    ///
+    /// @param core The core identifier
+    /// @return A reference to the object owned by the given core.
+    ///
+    T& operator[](size_t core)
+    {
+        return this->slots[core].value;
+    }
+};
+
+#endif /* Execution_PerCore_hpp */
@@ -0,0 +1,57 @@
+//
+//  PerCoreDispatcher.hpp
+//  Execution
+//
+//  Created by FireWolf on 2026-10-14.
+//
+
+#ifndef Execution_PerCoreDispatcher_hpp
+#define Execution_PerCoreDispatcher_hpp
+
+#include "Dispatcher.hpp"
+#include "PerCore.hpp"
+#include <optional>
+
+///
+/// The dispatcher on a multi-core system, each core of which runs its own dispatcher loop
+///
+/// @tparam Provider Specify the provider of the current core identifier
+/// @tparam Task Specify the type of runnable task
+/// @tparam ServiceIdentifier Specify the type of the service identifier returned by the context switcher
+/// @tparam ServiceRoutineMapper Specify the mapper that maps an identifier to the corresponding service routine
+/// @tparam Switcher Specify the type of the context switcher
+/// @tparam Injector A list of injector to inject code before the task is switched to run
+/// @note Each core owns its dispatcher state (i.e. the interrupted and the next task) in its own cache line,
+///       so the fast path of the dispatcher shares no mutable state with other cores.
+/// @note Kernel service routines retrieve the scheduler and the controller owned by the current core,
+///       if developers declare them with `OSDeclarePerCoreTaskSchedulerWithKernelServiceRoutine`
+///       and `OSDeclarePerCoreTaskControllerWithKernelServiceRoutine`.
+/// @see `Dispatcher` for details of the dispatcher loop.
+///
+template <CoreIdentifierProvider Provider, typename Task, typename ServiceIdentifier, typename ServiceRoutineMapper, typename Switcher, DispatcherCodeInjector<Task>... Injector>
+class PerCoreDispatcher
+{
+public:
+    /// The type of the dispatcher that runs on each core
+    using CoreDispatcher = Dispatcher<Task, ServiceIdentifier, ServiceRoutineMapper, Switcher, Injector...>;
+
+private:
+    /// The dispatcher owned by each core
+    static inline PerCoreStorage<std::optional<CoreDispatcher>, Provider> dispatchers;
+
+public:
+    ///
+    /// Start the kernel dispatcher loop on the current core
+    ///
+    /// @param prev The task that is interrupted, typically the idle task of the current core
+    /// @param next The first task that will run on the current core
+    /// @note Each core must invoke this function once at the end of its kernel initialization.
+    ///
+    __attribute__((noreturn))
+    static void dispatch(Task* prev, Task* next)
+    {
+        dispatchers.current().emplace(prev, next).dispatch();
+    }
+};
+
+#endif /* Execution_PerCoreDispatcher_hpp */
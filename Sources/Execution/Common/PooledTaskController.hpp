@@ -0,0 +1,205 @@
+//
+//  PooledTaskController.hpp
+//  Execution
+//
+//  Created by FireWolf on 2026-10-14.
+//
+
+#ifndef Execution_PooledTaskController_hpp
+#define Execution_PooledTaskController_hpp
+
+#include <Types.hpp>
+#include <Debug.hpp>
+#include <algorithm>
+#include <bit>
+#include <memory>
+#include <new>
+#include "TaskConstraints.hpp"
+
+///
+/// A task controller that manages a fixed number of task control blocks
+///
+/// @tparam T Specify the type of the task control block
+/// @tparam N Specify the maximum number of tasks that can coexist on the system; Must be less than 65536, so that an identifier keeps at least 16 bits of generation
+/// @note This controller satisfies the constraint `TaskControllerProvidesBasicAllocationSupport`.
+/// @note Both allocation and release take constant time.
+///       The controller threads an intrusive free list through unused task control blocks,
+///       and hands out blocks that have never been allocated in order, so it needs no initialization pass.
+///       A block is constructed when it is allocated and destroyed when it is released,
+///       so each new task starts with freshly initialized components.
+/// @note If the task satisfies `TaskHasUniqueIdentifier`, each allocated block is assigned an identifier
+///       that encodes its index in the low bits and the generation of the block in the high bits.
+///       A recycled block gets a new identifier, so a stale identifier of a finished task is never mistaken for a live one,
+///       and `lookup()` maps an identifier to its block by indexing without any search.
+///       Do not combine this controller with the initializer `AssignUniqueIdentifier`.
+/// @note The controller assumes that it is accessed in the kernel with interrupts disabled.
+///
+template <typename T, size_t N>
+requires (N > 0) && (N < (size_t{1} << 16))
+struct PooledTaskController
+{
+    /// The type of the task control block
+    using Task = T;
+
+private:
+    /// A task control block or a link to the next free block
+    union Slot
+    {
+        Slot* next;
+
+        Task task;
+
+        Slot() : next(nullptr) {}
+
+        ~Slot() {}
+    };
+
+    /// The number of low bits in an identifier that encode the index of the block
+    static constexpr UInt32 kIndexBits = std::max<UInt32>(std::bit_width(N - 1), 1);
+
+    /// The mask that extracts the index from an identifier
+    static constexpr UInt32 kIndexMask = (UInt32{1} << kIndexBits) - 1;
+
+    /// Task control blocks managed by the controller
+    Slot slots[N];
+
+    /// The generation of each block; An odd generation indicates that the block is in use
+    UInt32 generations[N] = {};
+
+    /// The list of blocks that have been released
+    Slot* freeList = nullptr;
+
+    /// The number of blocks that have never been allocated
+    size_t numFreshSlots = N;
+
+    /// The number of blocks in use
+    size_t numTasks = 0;
+
+    /// Private helper to build the identifier of the block at the given index
+    UInt32 makeIdentifier(size_t index) const
+    {
+        return (this->generations[index] >> 1) << kIndexBits | static_cast<UInt32>(index);
+    }
+
+    /// Private helper to get the index of the given block
+    size_t indexOf(const Task* task) const
+    {
+        return reinterpret_cast<const Slot*>(task) - this->slots;
+    }
+
+public:
+    ///
+    /// Allocate a free task control block
+    ///
+    /// @return A newly constructed task control block on success, `nullptr` if all blocks are in use.
+    ///
+    Task* allocate()
+    {
+        Slot* slot = nullptr;
+
+        // Prefer a recycled block
+        if (this->freeList != nullptr)
+        {
+            slot = this->freeList;
+
+            this->freeList = slot->next;
+        }
+        else if (this->numFreshSlots != 0)
+        {
+            slot = &this->slots[N - this->numFreshSlots--];
+        }
+        else
+        {
+            return nullptr;
+        }
+
+        size_t index = slot - this->slots;
+
+        // Mark the block as in use
+        this->generations[index] += 1;
+
+        this->numTasks += 1;
+
+        Task* task = std::construct_at(&slot->task);
+
+        if constexpr (TaskConstraints::TaskHasUniqueIdentifier<Task>)
+        {
+            task->setUniqueIdentifier(this->makeIdentifier(index));
+        }
+
+        return task;
+    }
+
+    ///
+    /// Release a task control block
+    ///
+    /// @param task A task control block returned by `allocate()`
+    ///
+    void release(Task* task)
+    {
+        precondition(this->contains(task), "The given task does not belong to the controller.");
+
+        size_t index = this->indexOf(task);
+
+        precondition(this->generations[index] % 2 == 1, "The given task has already been released.");
+
+        std::destroy_at(task);
+
+        // Mark the block as free, which also invalidates its identifier
+        this->generations[index] += 1;
+
+        this->numTasks -= 1;
+
+        Slot* slot = &this->slots[index];
+
+        slot->next = this->freeList;
+
+        this->freeList = slot;
+    }
+
+    ///
+    /// Find the task control block that has the given identifier
+    ///
+    /// @param identifier The task identifier
+    /// @return The task control block on success, `nullptr` if the identifier is invalid or the task has been released.
+    ///
+    Task* lookup(UInt32 identifier)
+    {
+        size_t index = identifier & kIndexMask;
+
+        // Guard: The block must be in use and have the same generation
+        if (index >= N || this->generations[index] % 2 == 0 || this->makeIdentifier(index) != identifier)
+        {
+            return nullptr;
+        }
+
+        return &this->slots[index].task;
+    }
+
+    ///
+    /// Check whether the given task control block belongs to the controller
+    ///
+    /// @param task The address of a task control block
+    /// @return `true` if the block is managed by the controller, `false` otherwise.
+    ///
+    bool contains(const Task* task) const
+    {
+        auto address = reinterpret_cast<uintptr_t>(task);
+
+        auto start = reinterpret_cast<uintptr_t>(&this->slots[0]);
+
+        return address >= start && address < start + sizeof(this->slots) && (address - start) % sizeof(Slot) == 0;
+    }
+
+    ///
+    /// Get the number of task control blocks in use
+    ///
+    /// @return The number of tasks that have been allocated but not released.
+    ///
+    size_t getNumTasks() const
+    {
+        return this->numTasks;
+    }
+};
+
+#endif /* Execution_PooledTaskController_hpp */
@@ -0,0 +1,117 @@
+//
+//  ServiceRoutineTable.hpp
+//  Execution
+//
+//  Created by FireWolf on 2026-10-14.
+//
+
+#ifndef Execution_ServiceRoutineTable_hpp
+#define Execution_ServiceRoutineTable_hpp
+
+#include "Dispatcher.hpp"
+#include "KernelServiceRoutines.hpp"
+#include <array>
+#include <type_traits>
+#include <utility>
+
+/// Private helpers to deduce the task type from a kernel service routine
+namespace ServiceRoutineTableKPI
+{
+    ///
+    /// Deduce the task type from a non-type template argument that points to a kernel service routine
+    ///
+    /// @note Signature of the routine: `Task* (*)(Task*)`.
+    ///
+    template <auto Routine>
+    struct RoutineTraits;
+
+    template <typename T, T* (*R)(T*)>
+    struct RoutineTraits<R>
+    {
+        using Task = T;
+
+        using Routine = T* (*)(T*);
+    };
+
+    /// Extract the task type from the first routine in the list
+    template <auto Routine, auto... Routines>
+    struct FirstRoutineTraits: RoutineTraits<Routine> {};
+}
+
+///
+/// A kernel service routine mapper that builds a compile-time table indexed by the service identifier
+///
+/// @tparam Identifier Specify the type of the service identifier; Must be an integral or enumeration type
+/// @tparam Routines Specify the address of kernel service routines, the i-th of which services the identifier `i`
+/// @note This mapper is a drop-in replacement of a handwritten mapper for the dispatcher.
+///       The table is a `constexpr` array, so looking up a routine never constructs a temporary mapper at runtime.
+///       It also provides direct invocation support, so the compiler can inline routines defined by
+///       `OSDefineAndRouteKernelRoutine` or lower the lookup to a jump table.
+/// @note An identifier that is not covered by the table is routed to `UnknownServiceIdentifier`.
+/// @example Define a mapper for three system calls:
+///          `using Mapper = StaticServiceRoutineTable<UInt32, &sysRoutine0, &sysRoutine1, &sysRoutine2>;`
+///
+template <typename Identifier, auto... Routines>
+requires (sizeof...(Routines) > 0) &&
+         (std::is_integral_v<Identifier> || std::is_enum_v<Identifier>) &&
+         (std::same_as<decltype(Routines), typename ServiceRoutineTableKPI::FirstRoutineTraits<Routines...>::Routine> && ...)
+struct StaticServiceRoutineTable
+{
+    /// The type of task handled by kernel service routines
+    using Task = typename ServiceRoutineTableKPI::FirstRoutineTraits<Routines...>::Task;
+
+    /// The type of kernel service routine
+    using Routine = typename ServiceRoutineTableKPI::FirstRoutineTraits<Routines...>::Routine;
+
+private:
+    /// Private routine to report an error when the identifier is out of range
+    static Task* unknown(Task* task)
+    {
+        return KernelServiceRoutines::UnknownServiceIdentifier<Task>{}(task);
+    }
+
+    /// The table of kernel service routines indexed by the service identifier
+    static constexpr std::array<Routine, sizeof...(Routines)> routines = { Routines... };
+
+    /// Convert the given identifier to the index in the table
+    static constexpr size_t index(const Identifier& identifier)
+    {
+        return static_cast<size_t>(identifier);
+    }
+
+public:
+    ///
+    /// Map the given identifier to the corresponding service routine
+    ///
+    /// @param identifier The service identifier
+    /// @return The non-null function pointer to the service routine.
+    ///
+    constexpr Routine operator()(const Identifier& identifier) const
+    {
+        return index(identifier) < routines.size() ? routines[index(identifier)] : &unknown;
+    }
+
+    ///
+    /// Invoke the service routine that corresponds to the given identifier
+    ///
+    /// @param identifier The service identifier
+    /// @param task The current interrupted task
+    /// @return The non-null next task that is selected to run.
+    /// @note Each entry is a compile-time constant, so the compiler can inline routines at each comparison
+    ///       and typically lowers the chain of comparisons to a jump table.
+    ///
+    static inline Task* invoke(const Identifier& identifier, Task* task)
+    {
+        Task* next = nullptr;
+
+        // A fold expression that compares the identifier with each index and calls the matched routine directly
+        bool found = [&]<size_t... I>(std::index_sequence<I...>) -> bool
+        {
+            return ((index(identifier) == I ? (next = Routines(task), true) : false) || ...);
+        }(std::make_index_sequence<sizeof...(Routines)>());
+
+        return found ? next : unknown(task);
+    }
+};
+
+#endif /* Execution_ServiceRoutineTable_hpp */
@@ -0,0 +1,92 @@
+//
+//  StackPainter.hpp
+//  Execution
+//
+//  Created by FireWolf on 2026-10-14.
+//
+
+#ifndef Execution_StackPainter_hpp
+#define Execution_StackPainter_hpp
+
+#include <Types.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+///
+/// Fill stacks with a known pattern and measure the deepest usage of each stack
+///
+/// @tparam Pattern Specify the byte used to paint the stack
+/// @tparam GuardSize Specify the number of bytes at the stack limit that are reserved by a stack limit guard, e.g. a canary word
+/// @note Stacks grow downwards, so the deepest usage is found by scanning from the stack limit towards the top
+///       until the first byte that no longer holds the pattern.
+///       The scan compares a word at a time, and stops as soon as the used region is reached,
+///       so a stack that is mostly unused is scanned in the time proportional to its unused part.
+/// @note A task may leave some bytes that happen to equal the pattern, so the result is a lower bound of the real usage,
+///       which is accurate in practice with a pattern that is unlikely to be a common value.
+/// @note For `SharedStackSupport`, paint the shared stack once at kernel initialization and query it at any time.
+///
+template <UInt8 Pattern = 0xA5, size_t GuardSize = 0>
+struct StackPainter
+{
+private:
+    /// The pattern replicated to fill a word
+    static constexpr uintptr_t kPatternWord = static_cast<uintptr_t>(-1) / 0xFF * Pattern;
+
+public:
+    /// The number of bytes at the stack limit that are neither painted nor scanned
+    static constexpr size_t kGuardSize = GuardSize;
+
+    ///
+    /// Paint the given stack
+    ///
+    /// @param stack The start address of the stack, i.e. its limit
+    /// @param size The size of the stack in bytes
+    /// @note Paint the stack before the initial execution context is built at its top.
+    ///
+    static void paint(UInt8* stack, size_t size)
+    {
+        memset(stack + GuardSize, Pattern, size - GuardSize);
+    }
+
+    ///
+    /// Get the maximum number of bytes that have been used since the stack was painted
+    ///
+    /// @param stack The start address of the stack, i.e. its limit
+    /// @param size The size of the stack in bytes
+    /// @return The high water mark in bytes, excluding the guard.
+    ///
+    static size_t getHighWaterMark(const UInt8* stack, size_t size)
+    {
+        const UInt8* current = stack + GuardSize;
+
+        const UInt8* end = stack + size;
+
+        // Scan a byte at a time until the address is aligned
+        while (current < end && reinterpret_cast<uintptr_t>(current) % sizeof(uintptr_t) != 0 && *current == Pattern)
+        {
+            current += 1;
+        }
+
+        // Scan a word at a time until a word that contains a used byte
+        if (current < end && reinterpret_cast<uintptr_t>(current) % sizeof(uintptr_t) == 0)
+        {
+            uintptr_t word;
+
+            while (end - current >= static_cast<ptrdiff_t>(sizeof(word)) && (memcpy(&word, current, sizeof(word)), word == kPatternWord))
+            {
+                current += sizeof(word);
+            }
+        }
+
+        // Locate the exact used byte
+        while (current < end && *current == Pattern)
+        {
+            current += 1;
+        }
+
+        return end - current;
+    }
+};
+
+#endif /* Execution_StackPainter_hpp */
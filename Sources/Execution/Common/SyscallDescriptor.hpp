@@ -0,0 +1,140 @@
+//
+//  SyscallDescriptor.hpp
+//  Execution
+//
+//  Created by FireWolf on 2026-10-14.
+//
+
+#ifndef Execution_SyscallDescriptor_hpp
+#define Execution_SyscallDescriptor_hpp
+
+#include <Types.hpp>
+#include <concepts>
+#include <cstddef>
+#include "TaskConstraints.hpp"
+
+///
+/// A list of system call arguments laid out in declaration order
+///
+/// @tparam Args Specify the type of each argument
+/// @note Each argument is stored at its natural alignment, so the layout is identical in the user space and the kernel.
+///       The kernel reads each argument in place via `get<I>()` without copying the list.
+///
+template <typename... Args>
+struct SyscallArguments {};
+
+template <typename Head, typename... Tail>
+struct SyscallArguments<Head, Tail...>
+{
+private:
+    Head head;
+
+    SyscallArguments<Tail...> tail;
+
+public:
+    SyscallArguments(Head first, Tail... rest) : head(first), tail(rest...) {}
+
+    ///
+    /// Get the argument at the given index
+    ///
+    /// @tparam I Specify the index of the argument
+    /// @return A reference to the argument stored in the list.
+    ///
+    template <size_t I>
+    requires (I <= sizeof...(Tail))
+    const auto& get() const
+    {
+        if constexpr (I == 0)
+        {
+            return this->head;
+        }
+        else
+        {
+            return this->tail.template get<I - 1>();
+        }
+    }
+};
+
+///
+/// Specify the constraint of the architecture-dependent trap that enters the kernel with a typed system call
+///
+/// @note The trap passes the system call identifier and the pointer to the argument list to the kernel,
+///       e.g. in the identifier register and the 1st argument register respectively.
+///
+template <typename Trap>
+concept SyscallTrap = requires(UInt32 identifier, const void* arguments)
+{
+    ///
+    /// The trap can be initialized with zero arguments
+    ///
+    requires std::default_initializable<Trap>;
+
+    ///
+    /// The trap must implement the operator `()` that enters the kernel and returns the kernel return value
+    ///
+    { Trap{}(identifier, arguments) } -> std::same_as<int>;
+};
+
+///
+/// A typed system call descriptor shared by user stubs and kernel service routines
+///
+/// @tparam Identifier Specify the system call identifier
+/// @tparam Args Specify the type of each system call argument
+/// @note The user stub packs arguments into `Arguments` on its own stack and passes a pointer to it to the kernel.
+///       The kernel service routine reads the list in place, so neither side relies on `va_list`.
+///       Both sides are compiled against the same descriptor, so an argument count or type mismatch is a compile error.
+/// @note On systems that isolate tasks from the kernel,
+///       the kernel must validate the pointer to the argument list before dereferencing it.
+/// @example Define the system call that creates a thread with its entry point, stack size and identifier:
+///          `using SyscallCreateThread = Syscall<1, const UInt8*, size_t, UInt32>;`
+///
+template <UInt32 Identifier, typename... Args>
+struct Syscall
+{
+    /// The system call identifier
+    static constexpr UInt32 kIdentifier = Identifier;
+
+    /// The number of system call arguments
+    static constexpr size_t kNumArguments = sizeof...(Args);
+
+    /// The type of the argument list passed to the kernel
+    using Arguments = SyscallArguments<Args...>;
+
+    ///
+    /// [USER] Invoke the system call with the given arguments
+    ///
+    /// @tparam Trap Specify the architecture-dependent trap
+    /// @param args System call arguments
+    /// @return The kernel return value.
+    ///
+    template <SyscallTrap Trap>
+    static int invoke(Args... args)
+    {
+        const Arguments arguments(args...);
+
+        return Trap{}(Identifier, &arguments);
+    }
+
+    ///
+    /// [KERNEL] Fetch the argument list passed by the given task
+    ///
+    /// @param task The task that invokes the system call
+    /// @return A non-null pointer to the argument list that resides in the user space.
+    ///
+    template <typename Task>
+    requires TaskConstraints::TaskProvidesSequentialSyscallArgumentsAccess<Task> ||
+             TaskConstraints::TaskProvidesIndexedSyscallArgumentsAccess<Task>
+    static const Arguments* fetch(Task* task)
+    {
+        if constexpr (TaskConstraints::TaskProvidesIndexedSyscallArgumentsAccess<Task>)
+        {
+            return task->template getSyscallArgument<const Arguments*, 0>();
+        }
+        else
+        {
+            return task->template getSyscallArgument<const Arguments*>();
+        }
+    }
+};
+
+#endif /* Execution_SyscallDescriptor_hpp */
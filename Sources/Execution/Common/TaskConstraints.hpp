@@ -8,6 +8,7 @@
 #ifndef Execution_TaskConstraints_hpp
 #define Execution_TaskConstraints_hpp
 
+#include <atomic>
 #include <concepts>
 #include <Types.hpp>
 #include <Scheduler/Constraint/Prioritizable.hpp>
@@ -33,6 +34,23 @@ namespace TaskConstraints
         { task.template getSyscallArgument<int>() } -> std::same_as<int>;
     };
 
+    ///
+    /// Define the constraint on the task control block
+    ///
+    /// @note A task control block exposes a public function to retrieve each system call argument by its index.
+    ///       i.e. The provider function is stateless and reads the argument from the saved register frame directly.
+    ///
+    template <typename Task>
+    concept TaskProvidesIndexedSyscallArgumentsAccess = requires(Task& task)
+    {
+        ///
+        /// Signature:
+        /// template <typename T, size_t Index>
+        /// T getSyscallArgument();
+        ///
+        { task.template getSyscallArgument<int, 0>() } -> std::same_as<int>;
+    };
+
     ///
     /// Define the constraint on the task control block
     ///
@@ -42,9 +60,9 @@ namespace TaskConstraints
     concept TaskCanInvokeSystemCall = requires(Task& task, int kernelReturnValue)
     {
         ///
-        /// The kernel can retrieve the system call arguments sequentially
+        /// The kernel can retrieve the system call arguments sequentially or by index
         ///
-        requires TaskProvidesSequentialSyscallArgumentsAccess<Task>;
+        requires TaskProvidesSequentialSyscallArgumentsAccess<Task> || TaskProvidesIndexedSyscallArgumentsAccess<Task>;
 
         ///
         /// The kernel can set the kernel return value properly
@@ -142,6 +160,201 @@ namespace TaskConstraints
     ///
     template <typename Task>
     concept TaskIsPrioritizableByPriority = PrioritizableByMutablePriority<Task>;
+
+    ///
+    /// Define the constraint on the task control block
+    ///
+    /// @note A task has a core affinity mask, in which the bit `n` is set if the task may run on the core `n`.
+    ///
+    template <typename Task>
+    concept TaskHasCoreAffinity = requires(Task& task, UInt32 affinity)
+    {
+        ///
+        /// Task control block provides R/W access to its core affinity mask
+        ///
+        { task.getCoreAffinity() } -> std::unsigned_integral;
+        { task.setCoreAffinity(affinity) } -> std::same_as<void>;
+    };
+
+    ///
+    /// Define the constraint on the task control block
+    ///
+    /// @note A task carries the message attached to the event that activates its handler.
+    ///
+    template <typename Task>
+    concept TaskHasEventMessage = requires(Task& task)
+    {
+        ///
+        /// The type of the message
+        ///
+        typename Task::EventMessageType;
+
+        ///
+        /// Task control block provides R/W access to the attached message
+        ///
+        /// @note The message is `nullptr` if the handler has no pending message.
+        ///
+        { task.getEventMessage() } -> std::same_as<typename Task::EventMessageType*>;
+        { task.setEventMessage(static_cast<typename Task::EventMessageType*>(nullptr)) } -> std::same_as<void>;
+    };
+
+    ///
+    /// Define the constraint on the task control block
+    ///
+    /// @note A task coalesces repeated events that are sent while its handler is pending.
+    ///       The event handler trampoline context injectors take pending events right before the context of the handler is built.
+    ///
+    template <typename Task>
+    concept TaskCoalescesEvents = requires(Task& task)
+    {
+        ///
+        /// Task control block counts a sent event and reports whether the handler was idle before
+        ///
+        { task.addPendingEvent() } -> std::same_as<bool>;
+
+        ///
+        /// Task control block returns the number of pending events and marks the handler as idle
+        ///
+        { task.takePendingEvents() } -> std::unsigned_integral;
+    };
+
+    ///
+    /// Define the constraint on the task control block
+    ///
+    /// @note A task records whether its event handler has an activation on the stack,
+    ///       i.e. the handler has started running but has not returned yet.
+    ///       A task that is not an event handler but has an execution context, e.g. the idle task, must be recorded as active.
+    ///
+    template <typename Task>
+    concept TaskTracksEventHandlerActivation = requires(Task& task, bool active)
+    {
+        { task.isActive() } -> std::same_as<bool>;
+        { task.setActive(active) } -> std::same_as<void>;
+    };
+
+    ///
+    /// Define the constraint on the task control block
+    ///
+    /// @note A task paints its stack when the stack is assigned, and reports the deepest usage of the stack.
+    ///
+    template <typename Task>
+    concept TaskTracksStackUsage = requires(Task& task, UInt8* stack, size_t size)
+    {
+        ///
+        /// Task control block records and paints the region of its stack
+        ///
+        { task.paintStack(stack, size) } -> std::same_as<void>;
+
+        ///
+        /// Task control block reports the maximum number of bytes used since the stack was painted
+        ///
+        { task.getStackHighWaterMark() } -> std::same_as<size_t>;
+    };
+
+    ///
+    /// Define the constraint on the task control block
+    ///
+    /// @note A task has a save area for the floating-point and vector register bank.
+    ///
+    template <typename Task>
+    concept TaskHasFPUContext = requires(Task& task, bool valid)
+    {
+        ///
+        /// The type of the saved register bank
+        ///
+        typename Task::FPUStateType;
+
+        ///
+        /// Task control block provides access to the save area
+        ///
+        { task.getFPUState() } -> std::same_as<typename Task::FPUStateType*>;
+
+        ///
+        /// Task control block provides R/W access to the flag that indicates whether the save area holds a valid register bank
+        ///
+        { task.hasFPUState() } -> std::same_as<bool>;
+        { task.setHasFPUState(valid) } -> std::same_as<void>;
+    };
+
+    ///
+    /// Define the constraint on the task control block
+    ///
+    /// @note A task can sleep on a timer wheel until its wakeup tick, and is linked to other sleeping tasks in the same slot.
+    ///
+    template <typename Task>
+    concept TaskCanSleep = requires(Task& task, Task* next)
+    {
+        ///
+        /// The type of the tick count
+        ///
+        typename Task::TickType;
+
+        requires std::unsigned_integral<typename Task::TickType>;
+
+        ///
+        /// Task control block provides R/W access to its wakeup tick
+        ///
+        { task.getWakeupTick() } -> std::same_as<typename Task::TickType>;
+        { task.setWakeupTick(typename Task::TickType{}) } -> std::same_as<void>;
+
+        ///
+        /// Task control block provides R/W access to the next sleeping task in the same slot
+        ///
+        { task.getNextSleepingTask() } -> std::same_as<Task*>;
+        { task.setNextSleepingTask(next) } -> std::same_as<void>;
+    };
+
+    ///
+    /// Define the constraint on the task control block
+    ///
+    /// @note A task can wait on a futex word, and is linked to other tasks waiting in the same bucket.
+    ///
+    template <typename Task>
+    concept TaskCanWaitOnFutex = requires(Task& task, Task* next, const std::atomic<UInt32>* address)
+    {
+        ///
+        /// Task control block provides R/W access to the address of the word on which it waits
+        ///
+        /// @note The address is `nullptr` if the task is not waiting.
+        ///
+        { task.getFutexAddress() } -> std::same_as<const std::atomic<UInt32>*>;
+        { task.setFutexAddress(address) } -> std::same_as<void>;
+
+        ///
+        /// Task control block provides R/W access to the next task waiting in the same bucket
+        ///
+        { task.getNextFutexWaiter() } -> std::same_as<Task*>;
+        { task.setNextFutexWaiter(next) } -> std::same_as<void>;
+    };
+
+    ///
+    /// Define the constraint on the task control block
+    ///
+    /// @note A task has precomputed descriptors of the memory protection regions that grant access to its dedicated stack.
+    ///
+    template <typename Task>
+    concept TaskHasMemoryProtectionRegions = requires(Task& task, const UInt8* stack, size_t size)
+    {
+        ///
+        /// The type of a region descriptor
+        ///
+        typename Task::MemoryRegionType;
+
+        ///
+        /// The number of region descriptors
+        ///
+        { Task::kNumMemoryRegions } -> std::convertible_to<size_t>;
+
+        ///
+        /// Task control block provides read access to region descriptors
+        ///
+        { task.getMemoryRegions() } -> std::same_as<const typename Task::MemoryRegionType*>;
+
+        ///
+        /// Task control block recomputes region descriptors for the given stack
+        ///
+        { task.setMemoryRegions(stack, size) } -> std::same_as<void>;
+    };
 }
 
 #endif /* Execution_TaskConstraints_hpp */
@@ -9,9 +9,15 @@
 #define Execution_TaskControlBlockComponents_hpp
 
 #include <Types.hpp>
+#include <atomic>
 #include <cstdarg>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
 #include "KernelServiceRoutines.hpp"
 #include "ExecutionContext.hpp"
+#include "StackPainter.hpp"
+#include "MemoryProtection.hpp"
 
 /// Define components that can be selected to assemble a task control block
 namespace TaskControlBlockComponents
@@ -37,6 +43,41 @@ namespace TaskControlBlockComponents
         }
     };
 
+    ///
+    /// Provide stack usage tracking support for a task
+    ///
+    /// @tparam Task Specify the type of the concrete task control block
+    /// @tparam Painter Specify the painter that fills and scans the stack, e.g. `StackPainter`
+    /// @note This component can be used to satisfy the task control block constraint `TaskTracksStackUsage`.
+    /// @note Stack initializers of the thread based model paint the stack automatically if the task has this component.
+    ///       Dump the high water mark of each task to size stacks with real data instead of guesses.
+    ///
+    template <typename Task, typename Painter = StackPainter<>>
+    struct StackUsageSupport
+    {
+    private:
+        UInt8* stackLimit = nullptr;
+
+        size_t stackSize = 0;
+
+    public:
+        using StackPainterType = Painter;
+
+        void paintStack(UInt8* stack, size_t size)
+        {
+            this->stackLimit = stack;
+
+            this->stackSize = size;
+
+            Painter::paint(stack, size);
+        }
+
+        size_t getStackHighWaterMark()
+        {
+            return this->stackLimit == nullptr ? 0 : Painter::getHighWaterMark(this->stackLimit, this->stackSize);
+        }
+    };
+
     ///
     /// Provide dedicated non-recyclable stack support for a task
     ///
@@ -79,7 +120,7 @@ namespace TaskControlBlockComponents
             return this->stack;
         }
 
-        void setPrivateStack(const UInt8* newStack)
+        void setPrivateStack(UInt8* newStack)
         {
             this->stack = newStack;
         }
@@ -117,6 +158,49 @@ namespace TaskControlBlockComponents
         }
     };
 
+    ///
+    /// Provide system call support for a task whose arguments are passed in registers
+    ///
+    /// @tparam Task Specify the type of the concrete task control block
+    /// @tparam Context Specify the type of the interrupt context stored on the stack
+    /// @note This component can be used to satisfy the task control block constraint `TaskCanInvokeSystemCall`.
+    /// @note Unlike `SystemCallSupport`, each argument is read from the saved register frame by its index at compile time,
+    ///       so the kernel can fetch all arguments in a single pass without any `va_list` state.
+    ///       As such, the type of each argument must be a scalar type that fits in a register.
+    ///
+    template <typename Task, typename Context>
+    requires ExecutionContextProvidesRegisterArguments<Context>
+    struct RegisterSyscallSupport
+    {
+    private:
+        Context* getExecutionContext()
+        {
+            return reinterpret_cast<Context*>(static_cast<Task*>(this)->getStackPointer());
+        }
+
+    public:
+        template <typename Arg, size_t Index>
+        requires std::is_scalar_v<Arg> && (sizeof(Arg) <= sizeof(uintptr_t))
+        Arg getSyscallArgument()
+        {
+            uintptr_t value = this->getExecutionContext()->template getSyscallArgument<Index>();
+
+            if constexpr (std::is_pointer_v<Arg>)
+            {
+                return reinterpret_cast<Arg>(value);
+            }
+            else
+            {
+                return static_cast<Arg>(value);
+            }
+        }
+
+        void setSyscallKernelReturnValue(int retVal)
+        {
+            this->getExecutionContext()->setSyscallKernelReturnValue(retVal);
+        }
+    };
+
     ///
     /// Provide unique numeric identifier support for a task
     ///
@@ -218,6 +302,34 @@ namespace TaskControlBlockComponents
         }
     };
 
+    ///
+    /// Provide core affinity support for a task
+    ///
+    /// @tparam Task Specify the type of the concrete task control block
+    /// @tparam Affinity Specify the type of the core affinity mask
+    /// @note This component can be used to satisfy the task control block constraint `TaskHasCoreAffinity`.
+    /// @note The bit `n` of the mask is set if the task may run on the core `n`.
+    ///       Load balancers only migrate a task to cores in its mask.
+    ///
+    template <typename Task, typename Affinity = UInt32>
+    requires std::unsigned_integral<Affinity>
+    struct CoreAffinitySupport
+    {
+    private:
+        Affinity affinity;
+
+    public:
+        Affinity getCoreAffinity()
+        {
+            return this->affinity;
+        }
+
+        void setCoreAffinity(Affinity newAffinity)
+        {
+            this->affinity = newAffinity;
+        }
+    };
+
     ///
     /// Provide unique numeric identifier support for a task
     ///
@@ -293,6 +405,265 @@ namespace TaskControlBlockComponents
             this->handler = newHandler;
         }
     };
+
+    ///
+    /// Provide the event coalescing component for a task
+    ///
+    /// @tparam Task Specify the type of the concrete task control block
+    /// @tparam Counter Specify the type of the pending event counter
+    /// @note This component can be used to satisfy the task control block constraint `TaskCoalescesEvents`.
+    /// @note The handler is pending if the counter is not zero.
+    ///       The first event marks the handler as pending, so the kernel notifies the scheduler once,
+    ///       while a repeated event only bumps the counter, which saturates instead of wrapping around.
+    /// @note The kernel takes the counter right before the context of the handler is built, and keeps the taken count,
+    ///       so that the context builder passes `getActivatedEvents()` to the handler, and events sent while the handler is running activate it again.
+    ///
+    template <typename Task, typename Counter = UInt32>
+    requires std::unsigned_integral<Counter>
+    struct CoalescingEventSupport
+    {
+    private:
+        Counter pendingEvents = 0;
+
+        Counter activatedEvents = 0;
+
+    public:
+        bool addPendingEvent()
+        {
+            bool idle = this->pendingEvents == 0;
+
+            if (this->pendingEvents != std::numeric_limits<Counter>::max())
+            {
+                this->pendingEvents += 1;
+            }
+
+            return idle;
+        }
+
+        Counter getPendingEvents() const
+        {
+            return this->pendingEvents;
+        }
+
+        Counter getActivatedEvents() const
+        {
+            return this->activatedEvents;
+        }
+
+        Counter takePendingEvents()
+        {
+            Counter count = this->pendingEvents;
+
+            this->pendingEvents = 0;
+
+            this->activatedEvents = count;
+
+            return count;
+        }
+    };
+
+    ///
+    /// Provide the event handler activation component for a task
+    ///
+    /// @tparam Task Specify the type of the concrete task control block
+    /// @note This component can be used to satisfy the task control block constraint `TaskTracksEventHandlerActivation`.
+    /// @note The handler is active from the time its context is built until it returns,
+    ///       so the kernel can tell a preempted handler from one that has not started yet.
+    /// @note A task is inactive by default. A task that is not an event handler but already has an execution context,
+    ///       e.g. the initial or the idle task passed to the dispatcher as the interrupted one, must be marked as active before the dispatcher starts,
+    ///       otherwise the kernel takes it for a handler that has not started yet and never resumes its saved context.
+    /// @see `ActivationTrackingEventHandlerTrampolineContextInjector::adopt()`.
+    ///
+    template <typename Task>
+    struct EventHandlerActivationSupport
+    {
+    private:
+        bool active = false;
+
+    public:
+        bool isActive() const
+        {
+            return this->active;
+        }
+
+        void setActive(bool newActive)
+        {
+            this->active = newActive;
+        }
+    };
+
+    ///
+    /// Provide the sleep component for a task
+    ///
+    /// @tparam Task Specify the type of the concrete task control block
+    /// @tparam Tick Specify the type of the tick count
+    /// @note This component can be used to satisfy the task control block constraint `TaskCanSleep`.
+    /// @note The link is intrusive, so inserting a task to a timer wheel never allocates memory.
+    ///
+    template <typename Task, typename Tick = UInt32>
+    requires std::unsigned_integral<Tick>
+    struct SleepSupport
+    {
+    private:
+        Tick wakeupTick = 0;
+
+        Task* nextSleepingTask = nullptr;
+
+    public:
+        using TickType = Tick;
+
+        Tick getWakeupTick()
+        {
+            return this->wakeupTick;
+        }
+
+        void setWakeupTick(Tick tick)
+        {
+            this->wakeupTick = tick;
+        }
+
+        Task* getNextSleepingTask()
+        {
+            return this->nextSleepingTask;
+        }
+
+        void setNextSleepingTask(Task* next)
+        {
+            this->nextSleepingTask = next;
+        }
+    };
+
+    ///
+    /// Provide the futex wait component for a task
+    ///
+    /// @tparam Task Specify the type of the concrete task control block
+    /// @note This component can be used to satisfy the task control block constraint `TaskCanWaitOnFutex`.
+    /// @note The link is intrusive, so waiting on a futex word never allocates memory.
+    ///
+    template <typename Task>
+    struct FutexWaitSupport
+    {
+    private:
+        const std::atomic<UInt32>* futexAddress = nullptr;
+
+        Task* nextFutexWaiter = nullptr;
+
+    public:
+        const std::atomic<UInt32>* getFutexAddress()
+        {
+            return this->futexAddress;
+        }
+
+        void setFutexAddress(const std::atomic<UInt32>* address)
+        {
+            this->futexAddress = address;
+        }
+
+        Task* getNextFutexWaiter()
+        {
+            return this->nextFutexWaiter;
+        }
+
+        void setNextFutexWaiter(Task* next)
+        {
+            this->nextFutexWaiter = next;
+        }
+    };
+
+    ///
+    /// Provide the floating-point and vector context component for a task
+    ///
+    /// @tparam Task Specify the type of the concrete task control block
+    /// @tparam State Specify the type of the saved register bank
+    /// @note This component can be used to satisfy the task control block constraint `TaskHasFPUContext`.
+    /// @note The save area is valid only after the task has used the unit at least once,
+    ///       so a task that never uses the unit never has its register bank saved or restored.
+    ///
+    template <typename Task, typename State>
+    struct FPUContextSupport
+    {
+    private:
+        State fpuState;
+
+        bool fpuStateValid = false;
+
+    public:
+        using FPUStateType = State;
+
+        State* getFPUState()
+        {
+            return &this->fpuState;
+        }
+
+        bool hasFPUState() const
+        {
+            return this->fpuStateValid;
+        }
+
+        void setHasFPUState(bool valid)
+        {
+            this->fpuStateValid = valid;
+        }
+    };
+
+    ///
+    /// Provide the event message component for a task
+    ///
+    /// @tparam Task Specify the type of the concrete task control block
+    /// @tparam Message Specify the type of the message attached to an event
+    /// @note This component can be used to satisfy the task control block constraint `TaskHasEventMessage`.
+    /// @note The message is owned by the kernel message pool; The task only keeps a reference to it.
+    ///
+    template <typename Task, typename Message>
+    struct EventMessageSupport
+    {
+    private:
+        Message* message = nullptr;
+
+    public:
+        using EventMessageType = Message;
+
+        Message* getEventMessage()
+        {
+            return this->message;
+        }
+
+        void setEventMessage(Message* newMessage)
+        {
+            this->message = newMessage;
+        }
+    };
+
+    ///
+    /// Provide the memory protection component for a task
+    ///
+    /// @tparam Task Specify the type of the concrete task control block
+    /// @tparam MPU Specify the architecture-dependent controller of the memory protection unit
+    /// @note This component can be used to satisfy the task control block constraint `TaskHasMemoryProtectionRegions`.
+    /// @note Descriptors are computed once when the kernel assigns or allocates a dedicated stack to the task,
+    ///       and all regions are disabled until then.
+    ///
+    template <typename Task, MemoryProtectionController MPU>
+    struct MemoryProtectionSupport
+    {
+    private:
+        typename MPU::Region regions[MPU::kNumTaskRegions] = {};
+
+    public:
+        using MemoryRegionType = typename MPU::Region;
+
+        static constexpr size_t kNumMemoryRegions = MPU::kNumTaskRegions;
+
+        const MemoryRegionType* getMemoryRegions() const
+        {
+            return this->regions;
+        }
+
+        void setMemoryRegions(const UInt8* stack, size_t size)
+        {
+            MPU::describe(stack, size, this->regions);
+        }
+    };
 }
 
 #endif /* Execution_TaskControlBlockComponents_hpp */
@@ -0,0 +1,149 @@
+//
+//  TaskControlBlockLayout.hpp
+//  Execution
+//
+//  Created by FireWolf on 2026-10-14.
+//
+
+#ifndef Execution_TaskControlBlockLayout_hpp
+#define Execution_TaskControlBlockLayout_hpp
+
+#include <Types.hpp>
+#include <Debug.hpp>
+#include <concepts>
+#include <cstddef>
+
+/// Define composers that control the layout of a task control block assembled from components
+namespace TaskControlBlockLayout
+{
+    /// Private helpers to compute the layout of components
+    namespace KPI
+    {
+        /// A plain aggregate of the given components, used to measure their size without padding to a cache line
+        template <typename... Components>
+        struct PackedComponents: Components... {};
+
+        /// A probe that derives from the given class and appends the given number of bytes to it
+        template <typename Base, size_t Size>
+        struct TailProbe: Base
+        {
+            UInt8 bytes[Size];
+        };
+
+        ///
+        /// Get the number of bytes of the given class that cannot be reused by a derived class
+        ///
+        /// @tparam Base Specify the class to be measured
+        /// @return The size of the class excluding the tail padding in which the compiler may place the fields of a derived class.
+        /// @note The Itanium C++ ABI reuses the tail padding of a base class that is not a POD,
+        ///       so `sizeof()` overestimates the offset of the first field of a derived class.
+        ///
+        template <typename Base, size_t Size = 1>
+        consteval size_t GetDataSize()
+        {
+            if constexpr (sizeof(TailProbe<Base, Size>) > sizeof(Base))
+            {
+                return sizeof(Base) - (Size - 1);
+            }
+            else if constexpr (Size == sizeof(Base))
+            {
+                return 0;
+            }
+            else
+            {
+                return GetDataSize<Base, Size + 1>();
+            }
+        }
+
+        /// Explicit padding that prevents the compiler from placing other fields in the tail padding of a composer
+        template <size_t Size>
+        struct Padding
+        {
+            UInt8 bytes[Size];
+        };
+
+        template <>
+        struct Padding<0> {};
+
+        /// The given components followed by the padding that fills the rest of the cache line
+        template <size_t CacheLineSize, typename... Components>
+        struct PaddedComponents: Components..., Padding<CacheLineSize - GetDataSize<PackedComponents<Components...>>()> {};
+    }
+
+    ///
+    /// Group components that are accessed on every context switch into a single aligned cache line
+    ///
+    /// @tparam CacheLineSize Specify the size of a cache line in bytes
+    /// @tparam Components Specify the hot components, e.g. the stack pointer, the priority level and the state
+    /// @note Place this composer as the first base class of the task control block,
+    ///       so that the hot fields start at the beginning of the block, which is aligned to a cache line.
+    ///       The composer is explicitly padded up to the cache line size from the end of the hot fields rather than from their `sizeof()`,
+    ///       so cold components start at the next line even if the compiler reuses the tail padding of base classes,
+    ///       and a scheduler scan or a context switch touches exactly one cache line per task.
+    /// @note The compilation fails if the hot components do not fit in one cache line.
+    /// @example Assemble a task control block for the Cortex-A:
+    ///          `struct Task: HotComponents<64, DedicatedRecyclableStackSupport<Task>, PriorityLevelSupport<Task, UInt8>>,`
+    ///          `             ColdComponents<UniqueNumericIdentifierSupport<Task, UInt32>, StackUsageSupport<Task>> {};`
+    ///
+    template <size_t CacheLineSize, typename... Components>
+    requires (KPI::GetDataSize<KPI::PackedComponents<Components...>>() <= CacheLineSize)
+    struct alignas(CacheLineSize) HotComponents: KPI::PaddedComponents<CacheLineSize, Components...>
+    {
+        static_assert(KPI::GetDataSize<KPI::PaddedComponents<CacheLineSize, Components...>>() >= CacheLineSize,
+                      "The first cold field must start at the next cache line.");
+    };
+
+    ///
+    /// Group components that are rarely accessed after the task is created
+    ///
+    /// @tparam Components Specify the cold components, e.g. the stack base, the identifier and the event handler
+    /// @note Place this composer after `HotComponents`, so that cold fields never share the cache line of hot fields.
+    ///
+    template <typename... Components>
+    struct ColdComponents: Components... {};
+
+    ///
+    /// Move cold data out of the task control block to a side table organized as a struct of arrays
+    ///
+    /// @tparam Task Specify the type of the concrete task control block
+    /// @tparam N Specify the maximum number of tasks that can coexist on the system
+    /// @tparam Components Specify the cold components, each of which is stored in its own array
+    /// @note The task control block only keeps a 16-bit index into the side table,
+    ///       so an array of task control blocks crammed with hot fields is denser and friendlier to scheduler scans.
+    ///       A pass over one cold component of all tasks, e.g. collecting statistics, touches only the array of that component.
+    /// @note Building blocks access components through the task control block,
+    ///       so only data that is never required by a building block constraint should be moved to the side table,
+    ///       e.g. names, statistics and debugging information.
+    /// @note The developer assigns a distinct index in `[0, N)` to each task when it is created,
+    ///       e.g. the index of the task control block in `PooledTaskController` or `TableBasedEventController`.
+    ///
+    template <typename Task, size_t N, typename... Components>
+    requires (N > 0) && (N <= 65536)
+    struct ColdSideTable
+    {
+    private:
+        /// The array of the given cold component indexed by the side table index of each task
+        template <typename Component>
+        static inline Component columns[N];
+
+        /// The index of the cold data of this task
+        UInt16 coldIndex = 0;
+
+    public:
+        template <typename Component>
+        requires (std::same_as<Component, Components> || ...)
+        Component& getColdComponent()
+        {
+            return columns<Component>[this->coldIndex];
+        }
+
+        void setColdIndex(size_t index)
+        {
+            precondition(index < N, "The side table index is out of range.");
+
+            this->coldIndex = static_cast<UInt16>(index);
+        }
+    };
+}
+
+#endif /* Execution_TaskControlBlockLayout_hpp */
@@ -0,0 +1,349 @@
+//
+//  TimerWheel.hpp
+//  Execution
+//
+//  Created by FireWolf on 2026-10-14.
+//
+
+#ifndef Execution_TimerWheel_hpp
+#define Execution_TimerWheel_hpp
+
+#include <Types.hpp>
+#include <bit>
+#include <concepts>
+#include <limits>
+#include <optional>
+#include <type_traits>
+#include "TaskConstraints.hpp"
+
+///
+/// Specify the constraint of the architecture-dependent timer used by a tickless kernel
+///
+/// @note The timer has a free-running counter in ticks and a one-shot comparator that raises the timer interrupt,
+///       e.g. `CNTPCT_EL0` and `CNTP_CVAL_EL0` on ARMv8-A, or `SysTick` reprogrammed as a one-shot timer on Cortex-M.
+///
+template <typename Timer>
+concept TicklessTimer = requires(typename Timer::Tick ticks)
+{
+    ///
+    /// The timer must explicitly define the type of the tick count
+    ///
+    typename Timer::Tick;
+
+    requires std::unsigned_integral<typename Timer::Tick>;
+
+    ///
+    /// The timer must implement the static function that returns the number of ticks since boot
+    ///
+    { Timer::now() } -> std::same_as<typename Timer::Tick>;
+
+    ///
+    /// The timer must implement the static function that raises the timer interrupt after the given number of ticks
+    ///
+    /// @note The number of ticks is positive. The timer may clamp it to the range of its comparator.
+    ///
+    { Timer::program(ticks) } -> std::same_as<void>;
+
+    ///
+    /// The timer must implement the static function that cancels the pending timer interrupt
+    ///
+    { Timer::stop() } -> std::same_as<void>;
+};
+
+/// The timer policy of a kernel that advances the timer wheel on a periodic tick interrupt
+struct PeriodicTimer {};
+
+///
+/// A hierarchical timer wheel of sleeping tasks
+///
+/// @tparam Task Specify the type of the task control block that can sleep
+/// @tparam SlotBits Specify the number of bits of the slot index at each level, i.e. each level has `2^SlotBits` slots
+/// @tparam NumLevels Specify the number of levels
+/// @note The level `l` holds tasks whose wakeup tick is less than `2^(SlotBits * (l + 1))` ticks away,
+///       in the slot indexed by the bits `[SlotBits * l, SlotBits * (l + 1))` of the wakeup tick.
+///       Inserting a task links it to the head of a slot, and each tick expires the whole slot at the level 0,
+///       so both take constant time, while the slot at an upper level is cascaded to lower levels once its range is reached.
+///       A task is cascaded at most `NumLevels - 1` times, so the amortized cost per task is still constant.
+/// @note Each level keeps a bitmap of non-empty slots, so the wheel finds the next tick that needs attention in `O(NumLevels)`.
+///       A tickless kernel programs the hardware timer with `getTicksUntilNextExpiry()` and jumps over idle ticks.
+/// @note Wakeup ticks further than the range of the wheel are parked at the top level and placed again when they are cascaded.
+/// @note The wheel is a collection of static functions and variables and assumes that it is accessed in the kernel.
+///
+template <typename Task, UInt32 SlotBits = 6, UInt32 NumLevels = 4>
+requires TaskConstraints::TaskCanSleep<Task> &&
+         (SlotBits > 0) && (SlotBits <= 6) && (NumLevels > 0) &&
+         (SlotBits * NumLevels < std::numeric_limits<typename Task::TickType>::digits)
+struct HierarchicalTimerWheel
+{
+    /// The type of the tick count
+    using Tick = typename Task::TickType;
+
+private:
+    /// The number of slots at each level
+    static constexpr UInt32 kNumSlots = UInt32{1} << SlotBits;
+
+    /// The mask of the slot index
+    static constexpr Tick kSlotMask = kNumSlots - 1;
+
+    /// The maximum distance to a wakeup tick that fits in the wheel
+    static constexpr Tick kMaxDistance = (Tick{1} << (SlotBits * NumLevels)) - 1;
+
+    /// Sleeping tasks in each slot, linked by the task control block
+    static inline Task* slots[NumLevels][kNumSlots] = {};
+
+    /// The bitmap of non-empty slots at each level
+    static inline UInt64 occupied[NumLevels] = {};
+
+    /// The current tick
+    static inline Tick current = 0;
+
+    /// Private helper to get the slot index of the given tick at the given level
+    static constexpr UInt32 indexOf(Tick tick, UInt32 level)
+    {
+        return static_cast<UInt32>((tick >> (SlotBits * level)) & kSlotMask);
+    }
+
+    /// Private helper to link the given task to the slot that matches its wakeup tick
+    static void place(Task* task)
+    {
+        Tick distance = task->getWakeupTick() - current;
+
+        UInt32 level = 0;
+
+        while (level < NumLevels - 1 && distance >= (Tick{1} << (SlotBits * (level + 1))))
+        {
+            level += 1;
+        }
+
+        // Park a task that is too far away in the last slot to be reached at the top level
+        Tick tick = distance > kMaxDistance ? static_cast<Tick>(current + kMaxDistance) : task->getWakeupTick();
+
+        UInt32 index = indexOf(tick, level);
+
+        task->setNextSleepingTask(slots[level][index]);
+
+        slots[level][index] = task;
+
+        occupied[level] |= UInt64{1} << index;
+    }
+
+    /// Private helper to detach all tasks in the given slot
+    static Task* detach(UInt32 level, UInt32 index)
+    {
+        Task* head = slots[level][index];
+
+        slots[level][index] = nullptr;
+
+        occupied[level] &= ~(UInt64{1} << index);
+
+        return head;
+    }
+
+    ///
+    /// Private helper to get the distance to the next tick at which the given level needs attention
+    ///
+    /// @return The number of ticks from now, `0` if the level is empty.
+    /// @note A non-empty slot at the level 0 expires when its index is reached.
+    ///       A non-empty slot at an upper level is cascaded when the index is reached and all lower bits are zero.
+    ///
+    static Tick getDistanceToNextEvent(UInt32 level)
+    {
+        UInt64 bitmap = occupied[level];
+
+        if (bitmap == 0)
+        {
+            return 0;
+        }
+
+        // Rotate the bitmap so that the slot after the current one becomes the bit 0
+        UInt32 shift = (indexOf(current, level) + 1) % kNumSlots;
+
+        if constexpr (kNumSlots == 64)
+        {
+            bitmap = std::rotr(bitmap, static_cast<int>(shift));
+        }
+        else
+        {
+            bitmap = (bitmap >> shift) | (bitmap << (kNumSlots - shift));
+        }
+
+        Tick steps = static_cast<Tick>(std::countr_zero(bitmap)) + 1;
+
+        if (level == 0)
+        {
+            return steps;
+        }
+
+        // The slot is reached when the bits of the level are advanced by `steps` and the lower bits wrap to zero
+        Tick target = static_cast<Tick>(((current >> (SlotBits * level)) + steps) << (SlotBits * level));
+
+        return static_cast<Tick>(target - current);
+    }
+
+    ///
+    /// Private helper to move to the next tick
+    ///
+    /// @param expire A functor that consumes each task whose wakeup tick is reached
+    ///
+    template <typename Handler>
+    static void tick(Handler& expire)
+    {
+        current += 1;
+
+        // Cascade slots at upper levels whose range has been reached, from the top level down
+        for (UInt32 level = NumLevels - 1; level > 0; level -= 1)
+        {
+            if ((current & ((Tick{1} << (SlotBits * level)) - 1)) != 0)
+            {
+                continue;
+            }
+
+            Task* task = detach(level, indexOf(current, level));
+
+            while (task != nullptr)
+            {
+                Task* next = task->getNextSleepingTask();
+
+                place(task);
+
+                task = next;
+            }
+        }
+
+        // Expire the slot at the level 0
+        Task* task = detach(0, indexOf(current, 0));
+
+        while (task != nullptr)
+        {
+            Task* next = task->getNextSleepingTask();
+
+            task->setNextSleepingTask(nullptr);
+
+            expire(task);
+
+            task = next;
+        }
+    }
+
+public:
+    ///
+    /// Get the current tick of the wheel
+    ///
+    /// @return The tick that has been processed most recently.
+    ///
+    static Tick now()
+    {
+        return current;
+    }
+
+    ///
+    /// Insert the given task to the wheel
+    ///
+    /// @param task A non-null task control block that is not sleeping
+    /// @param deadline The tick at which the task should wake up
+    /// @return `true` on success, `false` if the deadline is not in the future.
+    /// @note Ticks wrap around, so the deadline must be less than half of the range of `Tick` away.
+    ///
+    static bool insert(Task* task, Tick deadline)
+    {
+        // Guard: The deadline must be in the future
+        if (static_cast<std::make_signed_t<Tick>>(deadline - current) <= 0)
+        {
+            return false;
+        }
+
+        task->setWakeupTick(deadline);
+
+        place(task);
+
+        return true;
+    }
+
+    ///
+    /// Check whether any task is sleeping on the wheel
+    ///
+    /// @return `true` if at least one task is sleeping, `false` otherwise.
+    ///
+    static bool hasSleepingTasks()
+    {
+        for (UInt32 level = 0; level < NumLevels; level += 1)
+        {
+            if (occupied[level] != 0)
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    ///
+    /// Get the number of ticks until the wheel needs attention
+    ///
+    /// @return The number of ticks from now, or `std::nullopt` if no task is sleeping.
+    /// @note The result is exact if the earliest task is at the level 0,
+    ///       and is a conservative lower bound if a slot at an upper level has to be cascaded first.
+    ///
+    static std::optional<Tick> getTicksUntilNextExpiry()
+    {
+        std::optional<Tick> result;
+
+        for (UInt32 level = 0; level < NumLevels; level += 1)
+        {
+            Tick distance = getDistanceToNextEvent(level);
+
+            if (distance != 0 && (!result || distance < *result))
+            {
+                result = distance;
+            }
+        }
+
+        return result;
+    }
+
+    ///
+    /// Advance the wheel to the given tick
+    ///
+    /// @param target The tick to advance to; Must not be earlier than the current tick
+    /// @param expire A functor that consumes each task whose wakeup tick is reached, in the order of wakeup ticks
+    /// @return The number of tasks that have expired.
+    /// @note The wheel jumps over ticks that need no attention,
+    ///       so a tickless kernel that advances the wheel by many ticks at once pays for non-empty slots only.
+    ///
+    template <typename Handler>
+    requires std::invocable<Handler&, Task*>
+    static size_t advance(Tick target, Handler&& expire)
+    {
+        size_t count = 0;
+
+        auto counter = [&](Task* task) -> void
+        {
+            count += 1;
+
+            expire(task);
+        };
+
+        while (current != target)
+        {
+            Tick remaining = target - current;
+
+            std::optional<Tick> distance = getTicksUntilNextExpiry();
+
+            // Guard: No slot needs attention before the target
+            if (!distance || *distance > remaining)
+            {
+                current = target;
+
+                break;
+            }
+
+            current += *distance - 1;
+
+            tick(counter);
+        }
+
+        return count;
+    }
+};
+
+#endif /* Execution_TimerWheel_hpp */
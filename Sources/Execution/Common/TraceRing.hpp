@@ -0,0 +1,158 @@
+//
+//  TraceRing.hpp
+//  Execution
+//
+//  Created by FireWolf on 2026-10-14.
+//
+
+#ifndef Execution_TraceRing_hpp
+#define Execution_TraceRing_hpp
+
+#include <Types.hpp>
+#include <atomic>
+#include <bit>
+#include <cstdint>
+#include "CycleCounter.hpp"
+#include "ExecutionLog.hpp"
+#include "TaskConstraints.hpp"
+
+///
+/// A binary trace record
+///
+/// @tparam Cycles Specify the type of the timestamp
+///
+template <typename Cycles>
+struct TraceRecord
+{
+    /// The cycle count when the record is emitted
+    Cycles timestamp;
+
+    /// The event identifier
+    UInt32 event;
+
+    /// Two words whose meaning depends on the event
+    uintptr_t words[2];
+};
+
+///
+/// A power-of-two ring buffer of binary trace records
+///
+/// @tparam Counter Specify the architecture-dependent cycle counter that provides timestamps
+/// @tparam Capacity Specify the number of records in the ring; Must be a power of two
+/// @note The ring has a single producer, i.e. the kernel with interrupts disabled.
+///       The producer never waits for consumers and overwrites the oldest record when the ring is full,
+///       so the ring always holds the most recent `Capacity` records, like a flight recorder.
+/// @note A consumer (a task, a debugger or a host tool reading a memory dump) first reads the total number of records,
+///       then reads up to `Capacity` most recent records in order.
+///       Records are formatted offline, so emitting a record does not change the timing much.
+/// @note This ring satisfies the constraint `ExecutionTracer` and can be passed to `ExecutionLog`.
+///
+template <CycleCounter Counter, size_t Capacity>
+requires (std::has_single_bit(Capacity)) && std::atomic<UInt32>::is_always_lock_free
+struct TraceRing
+{
+    /// The type of the record stored in the ring
+    using Record = TraceRecord<typename Counter::Cycles>;
+
+private:
+    /// Records in the ring
+    static inline Record records[Capacity];
+
+    /// The total number of records that have been emitted
+    static inline std::atomic<UInt32> count = 0;
+
+public:
+    ///
+    /// [Producer] Record the given event and two words
+    ///
+    /// @param event The event identifier
+    /// @param word0 The first word
+    /// @param word1 The second word
+    ///
+    template <typename Event>
+    static inline void record(Event event, uintptr_t word0, uintptr_t word1)
+    {
+        UInt32 index = count.load(std::memory_order_relaxed);
+
+        records[index & (Capacity - 1)] = { Counter::now(), static_cast<UInt32>(event), { word0, word1 } };
+
+        // Publish the record
+        count.store(index + 1, std::memory_order_release);
+    }
+
+    ///
+    /// [Consumer] Get the total number of records that have been emitted
+    ///
+    /// @return The total number of records, including those that have been overwritten.
+    ///
+    static UInt32 getNumRecords()
+    {
+        return count.load(std::memory_order_acquire);
+    }
+
+    ///
+    /// [Consumer] Get the record at the given sequence number
+    ///
+    /// @param sequence The sequence number of the record; Must be one of the most recent `Capacity` records
+    /// @return The record at the given sequence number.
+    ///
+    static Record getRecord(UInt32 sequence)
+    {
+        return records[sequence & (Capacity - 1)];
+    }
+
+    ///
+    /// [Consumer] Copy the most recent records in order
+    ///
+    /// @param buffer A non-null buffer that can hold at least `Capacity` records
+    /// @return The number of records copied to the buffer.
+    /// @note Records copied while the producer is running may be overwritten; Disable interrupts or stop tracing to get a consistent copy.
+    ///
+    static size_t copyRecords(Record* buffer)
+    {
+        UInt32 end = getNumRecords();
+
+        UInt32 start = end > Capacity ? end - Capacity : 0;
+
+        for (UInt32 sequence = start; sequence != end; sequence += 1)
+        {
+            buffer[sequence - start] = getRecord(sequence);
+        }
+
+        return end - start;
+    }
+};
+
+///
+/// A dispatcher code injector that records every context switch to a trace ring
+///
+/// @tparam Task Specify the type of the task control block that has a unique identifier
+/// @tparam Ring Specify the trace ring that stores records
+/// @note Each record holds the timestamp and the identifiers of the previous and the next task,
+///       so a host tool can rebuild the timeline of the system from a memory dump of the ring.
+/// @note Pass `TraceRecorder::Log` as the logging policy of event driven service routines
+///       to record sent events and finished event handlers to the same ring.
+///
+template <typename Task, ExecutionTracer Ring>
+requires TaskConstraints::TaskHasUniqueIdentifier<Task>
+struct TraceRecorder
+{
+    /// The logging policy that records binary trace records to the same ring without emitting messages
+    using Log = ExecutionLog<ExecutionLogLevel::None, Ring>;
+
+    ///
+    /// [Injector] Record the context switch from the previous task to the next one
+    ///
+    /// @param prev The task that is interrupted
+    /// @param next The task that is selected to run
+    ///
+    void operator()(Task* prev, Task* next)
+    {
+        if (prev != next)
+        {
+            Ring::record(ExecutionTraceEvent::ContextSwitched, TraceWord(prev), TraceWord(next));
+        }
+    }
+};
+
+#endif /* Execution_TraceRing_hpp */
@@ -0,0 +1,166 @@
+//
+//  WorkStealingDeque.hpp
+//  Execution
+//
+//  Created by FireWolf on 2026-10-14.
+//
+
+#ifndef Execution_WorkStealingDeque_hpp
+#define Execution_WorkStealingDeque_hpp
+
+#include <Types.hpp>
+#include <atomic>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+
+///
+/// A bounded lock-free work-stealing deque of pointers
+///
+/// @tparam T Specify the type of the element pointed by the stored pointer
+/// @tparam Capacity Specify the maximum number of elements in the deque; Must be a power of two
+/// @note This is the bounded variant of the Chase-Lev deque.
+///       The owner core pushes and pops elements at the bottom without contention,
+///       while other cores steal elements from the top with a single CAS.
+/// @note The owner must access the deque with interrupts disabled, e.g. in the kernel.
+///
+template <typename T, size_t Capacity>
+requires (std::has_single_bit(Capacity))
+struct WorkStealingDeque
+{
+private:
+    /// Elements in the deque
+    std::atomic<T*> elements[Capacity];
+
+    /// The position of the next element to be stolen
+    alignas(64) std::atomic<ptrdiff_t> top;
+
+    /// The position of the next element to be pushed by the owner
+    alignas(64) std::atomic<ptrdiff_t> bottom;
+
+public:
+    /// Create an empty deque
+    WorkStealingDeque() : elements{}, top(0), bottom(0) {}
+
+    ///
+    /// [Owner] Push an element to the bottom of the deque
+    ///
+    /// @param element A non-null element
+    /// @return `true` on success, `false` if the deque is full.
+    ///
+    bool push(T* element)
+    {
+        ptrdiff_t b = this->bottom.load(std::memory_order_relaxed);
+
+        ptrdiff_t t = this->top.load(std::memory_order_acquire);
+
+        // Guard: The deque is full
+        if (b - t >= static_cast<ptrdiff_t>(Capacity))
+        {
+            return false;
+        }
+
+        this->elements[b & (Capacity - 1)].store(element, std::memory_order_relaxed);
+
+        // Publish the element to thieves
+        std::atomic_thread_fence(std::memory_order_release);
+
+        this->bottom.store(b + 1, std::memory_order_relaxed);
+
+        return true;
+    }
+
+    ///
+    /// [Owner] Pop the most recently pushed element from the bottom of the deque
+    ///
+    /// @return The element on success, `nullptr` if the deque is empty.
+    ///
+    T* pop()
+    {
+        ptrdiff_t b = this->bottom.load(std::memory_order_relaxed) - 1;
+
+        this->bottom.store(b, std::memory_order_relaxed);
+
+        // Reserve the bottom element before checking thieves
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        ptrdiff_t t = this->top.load(std::memory_order_relaxed);
+
+        // Guard: The deque is empty
+        if (t > b)
+        {
+            this->bottom.store(b + 1, std::memory_order_relaxed);
+
+            return nullptr;
+        }
+
+        T* element = this->elements[b & (Capacity - 1)].load(std::memory_order_relaxed);
+
+        // The last element may be stolen in the meantime, so compete with thieves
+        if (t == b)
+        {
+            if (!this->top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+            {
+                element = nullptr;
+            }
+
+            this->bottom.store(b + 1, std::memory_order_relaxed);
+        }
+
+        return element;
+    }
+
+    ///
+    /// [Thief] Steal the least recently pushed element from the top of the deque
+    ///
+    /// @param predicate A functor that returns `true` if the thief accepts the given element
+    /// @return The element on success, `nullptr` if the deque is empty,
+    ///         the element at the top is rejected by the predicate or another core wins the race.
+    /// @note A thief never retries, so it can move on to another deque when it loses the race.
+    ///
+    template <typename Predicate>
+    requires std::predicate<Predicate&, T*>
+    T* steal(Predicate&& predicate)
+    {
+        ptrdiff_t t = this->top.load(std::memory_order_acquire);
+
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        ptrdiff_t b = this->bottom.load(std::memory_order_acquire);
+
+        // Guard: The deque is empty
+        if (t >= b)
+        {
+            return nullptr;
+        }
+
+        // The owner never overwrites the slot at `top` before it is claimed, so the element is valid if the CAS succeeds
+        T* element = this->elements[t & (Capacity - 1)].load(std::memory_order_relaxed);
+
+        // Guard: The thief does not accept the element
+        if (!predicate(element))
+        {
+            return nullptr;
+        }
+
+        // Guard: Claim the element
+        if (!this->top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+        {
+            return nullptr;
+        }
+
+        return element;
+    }
+
+    ///
+    /// [Thief] Steal the least recently pushed element from the top of the deque
+    ///
+    /// @return The element on success, `nullptr` if the deque is empty or another core wins the race.
+    ///
+    T* steal()
+    {
+        return this->steal([]([[maybe_unused]] T* element) -> bool { return true; });
+    }
+};
+
+#endif /* Execution_WorkStealingDeque_hpp */
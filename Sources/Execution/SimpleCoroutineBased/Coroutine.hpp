@@ -0,0 +1,403 @@
+//
+//  Coroutine.hpp
+//  Execution
+//
+//  Created by FireWolf on 2026-10-14.
+//
+
+#ifndef Execution_Coroutine_hpp
+#define Execution_Coroutine_hpp
+
+#include <Types.hpp>
+#include <Debug.hpp>
+#include <Execution/Common/ContextSwitcher.hpp>
+#include <Execution/Common/ExecutionContext.hpp>
+#include <concepts>
+#include <coroutine>
+#include <cstdint>
+#include <exception>
+#include <type_traits>
+#include <utility>
+
+///
+/// The system call frame of a suspended coroutine
+///
+/// @tparam NumArguments Specify the maximum number of system call arguments
+/// @note The frame is the counterpart of the register frame saved on the stack of a thread.
+///       It resides in the coroutine frame, i.e. in the awaiter of the pending system call,
+///       and the task control block reports its address as the stack pointer,
+///       so `RegisterSyscallSupport` reads arguments and writes the kernel return value without knowing about coroutines.
+///
+template <size_t NumArguments = 4>
+struct CoroutineExecutionContext
+{
+    /// The system call identifier
+    UInt32 identifier;
+
+    /// System call arguments
+    uintptr_t arguments[NumArguments];
+
+    /// The kernel return value
+    int kernelReturnValue;
+
+    UInt32 getSyscallIdentifier()
+    {
+        return this->identifier;
+    }
+
+    template <size_t Index>
+    requires (Index < NumArguments)
+    uintptr_t getSyscallArgument()
+    {
+        return this->arguments[Index];
+    }
+
+    void setSyscallKernelReturnValue(int krv)
+    {
+        this->kernelReturnValue = krv;
+    }
+};
+
+static_assert(ExecutionContextProvidesRegisterArguments<CoroutineExecutionContext<>>);
+
+/// The system call frame used by coroutine tasks
+using CoroutineSyscallFrame = CoroutineExecutionContext<>;
+
+///
+/// The body of a coroutine task
+///
+/// @note A function that returns `Coroutine` and uses `co_await` to invoke system calls runs as a stackless task.
+///       The body is created suspended and starts when the dispatcher switches to the task for the first time.
+///       Each system call suspends the body, so the dispatcher runs on its own stack and resumes the body later,
+///       without ever switching the stack pointer of the processor.
+/// @note The frame of the body is allocated by `operator new` as usual;
+///       Its size is known to the compiler and is typically much smaller than a thread stack.
+///       The frame is destroyed by `DestroyCoroutine` when the task finishes.
+///
+struct Coroutine
+{
+    /// The promise of a coroutine task
+    struct promise_type
+    {
+        /// The frame of the pending system call
+        CoroutineSyscallFrame* frame = nullptr;
+
+        /// The frame reported after the body returns, so that the kernel still has a place to write the return value
+        CoroutineSyscallFrame finalFrame = {};
+
+        Coroutine get_return_object()
+        {
+            return Coroutine(std::coroutine_handle<promise_type>::from_promise(*this));
+        }
+
+        std::suspend_always initial_suspend() noexcept
+        {
+            return {};
+        }
+
+        std::suspend_always final_suspend() noexcept
+        {
+            return {};
+        }
+
+        void return_void()
+        {
+            this->frame = &this->finalFrame;
+        }
+
+        void unhandled_exception()
+        {
+            std::terminate();
+        }
+    };
+
+    /// The type of the handle to a coroutine task
+    using Handle = std::coroutine_handle<promise_type>;
+
+private:
+    /// The handle to the body, or `nullptr` if the ownership has been transferred
+    Handle handle;
+
+public:
+    explicit Coroutine(Handle handle) : handle(handle) {}
+
+    Coroutine(Coroutine&& other) noexcept : handle(other.handle)
+    {
+        other.handle = nullptr;
+    }
+
+    Coroutine(const Coroutine&) = delete;
+
+    Coroutine& operator=(const Coroutine&) = delete;
+
+    ~Coroutine()
+    {
+        if (this->handle)
+        {
+            this->handle.destroy();
+        }
+    }
+
+    ///
+    /// Get the address of the body without transferring the ownership
+    ///
+    /// @return The address of the body, or `nullptr` if the ownership has been transferred.
+    ///
+    void* address() const noexcept
+    {
+        return this->handle.address();
+    }
+
+    ///
+    /// Transfer the ownership of the body to the kernel
+    ///
+    /// @return The address of the body, which is passed to `CreateCoroutine::KPI::AssignCoroutine`.
+    /// @note `CoroutineCreationAwaiter` invokes this function only after the kernel has created the task successfully.
+    ///
+    void* release()
+    {
+        Handle body = this->handle;
+
+        this->handle = nullptr;
+
+        return body.address();
+    }
+};
+
+///
+/// An awaiter that invokes a system call from a coroutine task
+///
+/// @tparam Identifier Specify the system call identifier
+/// @tparam Args Specify the type of each system call argument; Must be a scalar type that fits in a register
+/// @note The awaiter always suspends the body, and the dispatcher resumes it with the kernel return value.
+///
+template <UInt32 Identifier, typename... Args>
+requires (sizeof...(Args) <= std::extent_v<decltype(CoroutineSyscallFrame::arguments)>) &&
+         ((std::is_scalar_v<Args> && sizeof(Args) <= sizeof(uintptr_t)) && ...)
+struct CoroutineSyscallAwaiter
+{
+private:
+    /// Private helper to store an argument in a register
+    template <typename Arg>
+    static uintptr_t pack(Arg arg)
+    {
+        if constexpr (std::is_pointer_v<Arg>)
+        {
+            return reinterpret_cast<uintptr_t>(arg);
+        }
+        else
+        {
+            return static_cast<uintptr_t>(arg);
+        }
+    }
+
+    /// The frame of the system call
+    CoroutineSyscallFrame frame;
+
+public:
+    explicit CoroutineSyscallAwaiter(Args... args) : frame{ Identifier, { pack(args)... }, 0 } {}
+
+    bool await_ready() const noexcept
+    {
+        return false;
+    }
+
+    void await_suspend(Coroutine::Handle body) noexcept
+    {
+        body.promise().frame = &this->frame;
+    }
+
+    int await_resume() const noexcept
+    {
+        return this->frame.kernelReturnValue;
+    }
+};
+
+///
+/// An awaiter that invokes the system call to create a coroutine task
+///
+/// @tparam Identifier Specify the system call identifier
+/// @note The awaiter passes the address of the body to the kernel but keeps the ownership until the system call returns.
+///       The ownership is transferred to the kernel only if the task has been created successfully,
+///       otherwise the body is destroyed with the awaiter, so a failed creation never leaks the frame of the body.
+///
+template <UInt32 Identifier>
+struct CoroutineCreationAwaiter
+{
+private:
+    /// The body of the new task
+    Coroutine body;
+
+    /// The awaiter of the underlying system call
+    CoroutineSyscallAwaiter<Identifier, void*, UInt32> syscall;
+
+public:
+    CoroutineCreationAwaiter(Coroutine&& body, UInt32 identifier) : body(std::move(body)), syscall(this->body.address(), identifier) {}
+
+    bool await_ready() const noexcept
+    {
+        return false;
+    }
+
+    void await_suspend(Coroutine::Handle caller) noexcept
+    {
+        this->syscall.await_suspend(caller);
+    }
+
+    int await_resume() noexcept
+    {
+        int krv = this->syscall.await_resume();
+
+        // Guard: The kernel owns the body once the task has been created
+        if (krv == 0)
+        {
+            this->body.release();
+        }
+
+        return krv;
+    }
+};
+
+///
+/// [USER] Invoke a system call from a coroutine task
+///
+/// @tparam Identifier Specify the system call identifier
+/// @param args System call arguments
+/// @return An awaiter that produces the kernel return value.
+/// @example `int events = co_await CoroutineSyscall<kWaitEvent>(event);`
+///
+template <UInt32 Identifier, typename... Args>
+static inline CoroutineSyscallAwaiter<Identifier, Args...> CoroutineSyscall(Args... args)
+{
+    return CoroutineSyscallAwaiter<Identifier, Args...>(args...);
+}
+
+/// Define constraints on the task control block
+namespace TaskConstraints
+{
+    ///
+    /// Define the constraint on the task control block
+    ///
+    /// @note A task runs a coroutine body instead of owning a stack.
+    ///
+    template <typename Task>
+    concept TaskHasCoroutine = requires(Task& task, Coroutine::Handle body, bool waiting)
+    {
+        ///
+        /// Task control block provides R/W access to its coroutine body
+        ///
+        { task.getCoroutine() } -> std::same_as<Coroutine::Handle>;
+        { task.setCoroutine(body) } -> std::same_as<void>;
+
+        ///
+        /// Task control block provides R/W access to the flag that indicates whether the body is waiting for an event
+        ///
+        { task.isWaitingForEvent() } -> std::same_as<bool>;
+        { task.setWaitingForEvent(waiting) } -> std::same_as<void>;
+    };
+}
+
+/// Define components that can be selected to assemble a task control block
+namespace TaskControlBlockComponents
+{
+    ///
+    /// Provide coroutine support for a task
+    ///
+    /// @tparam Task Specify the type of the concrete task control block
+    /// @note This component can be used to satisfy the task control block constraints
+    ///       `TaskHasCoroutine`, `TaskProvidesStackPointerReadAccess` and `TaskProvidesStackPointerWriteAccess`.
+    /// @note The stack pointer of a coroutine task is the address of its pending system call frame,
+    ///       so combine this component with `RegisterSyscallSupport<Task, CoroutineSyscallFrame>` to service system calls.
+    ///
+    template <typename Task>
+    struct CoroutineSupport
+    {
+    private:
+        Coroutine::Handle body = nullptr;
+
+        bool waitingForEvent = false;
+
+    public:
+        Coroutine::Handle getCoroutine()
+        {
+            return this->body;
+        }
+
+        void setCoroutine(Coroutine::Handle newBody)
+        {
+            this->body = newBody;
+        }
+
+        bool isWaitingForEvent()
+        {
+            return this->waitingForEvent;
+        }
+
+        void setWaitingForEvent(bool waiting)
+        {
+            this->waitingForEvent = waiting;
+        }
+
+        UInt8* getStackPointer()
+        {
+            return this->body ? reinterpret_cast<UInt8*>(this->body.promise().frame) : nullptr;
+        }
+
+        void setStackPointer(UInt8* newStackPointer)
+        {
+            this->body.promise().frame = reinterpret_cast<CoroutineSyscallFrame*>(newStackPointer);
+        }
+    };
+}
+
+///
+/// A context switcher that resumes coroutine tasks on the kernel stack
+///
+/// @tparam T Specify the type of the task control block that runs a coroutine body
+/// @tparam FinishIdentifier Specify the service identifier reported when the body returns
+/// @note The switcher resumes the body of the next task, which runs until it invokes the next system call,
+///       and returns the identifier stored in the system call frame, so the common `Dispatcher` services coroutine tasks as is.
+///       No registers or stacks are switched; The compiler saves live variables of the body in its frame.
+/// @note Coroutine tasks are cooperative, i.e. they enter the kernel only via system calls.
+///       Interrupts that preempt a resumed body are serviced on the kernel stack and return to it as usual.
+///
+template <typename T, UInt32 FinishIdentifier>
+requires TaskConstraints::TaskHasCoroutine<T>
+struct CoroutineContextSwitcher
+{
+    using Task = T;
+
+    using ServiceIdentifier = UInt32;
+
+    ///
+    /// Resume the next task until it enters the kernel again
+    ///
+    /// @param prev The task that is interrupted
+    /// @param next The task that is selected to run
+    /// @return The system call identifier, or `FinishIdentifier` if the body has returned.
+    ///
+    static ServiceIdentifier switchTask([[maybe_unused]] Task* prev, Task* next)
+    {
+        Coroutine::Handle body = next->getCoroutine();
+
+        precondition(body && !body.done(), "The task does not have a runnable coroutine body.");
+
+        body.resume();
+
+        return body.done() ? FinishIdentifier : body.promise().frame->getSyscallIdentifier();
+    }
+
+    ///
+    /// Resume the interrupted task until it enters the kernel again
+    ///
+    /// @param task The task that is interrupted
+    /// @return The system call identifier, or `FinishIdentifier` if the body has returned.
+    /// @note A coroutine has no context to restore, so returning to the interrupted task skips injectors only.
+    ///
+    static ServiceIdentifier returnToTask(Task* task)
+    {
+        return switchTask(task, task);
+    }
+};
+
+#endif /* Execution_Coroutine_hpp */
@@ -0,0 +1,201 @@
+//
+//  KernelServiceRoutines.hpp
+//  Execution
+//
+//  Created by FireWolf on 2026-10-14.
+//
+
+#ifndef Execution_SimpleCoroutineBasedKernelServiceRoutines_hpp
+#define Execution_SimpleCoroutineBasedKernelServiceRoutines_hpp
+
+#include <Scheduler/Scheduler.hpp>
+#include <Execution/Common/TaskConstraints.hpp>
+#include <Execution/Common/KernelServiceRoutines.hpp>
+#include <Execution/Common/ExecutionLog.hpp>
+#include "Coroutine.hpp"
+
+///
+/// Defines kernel service routines for the simple coroutine based execution model
+///
+/// @note Coroutine tasks are created and terminated by the builders of the thread based model,
+///       i.e. `CreateThread::ServiceRoutineBuilderWithTaskArgs` with `AssignCoroutine` instead of stack initializers,
+///       and `FinishThread::ServiceRoutineBuilder` with `DestroyCoroutine` as a finalizer.
+///
+namespace KernelServiceRoutines::CreateCoroutine
+{
+    /// Private subroutine to initialize a task control block
+    namespace KPI
+    {
+        ///
+        /// [KPI] Private subroutine to assign a coroutine body to a task
+        ///
+        /// @tparam Task Specify the type of a task that runs a coroutine body
+        /// @note The argument is the address of a body that is still owned by the caller, e.g. `CoroutineCreationAwaiter`.
+        ///       The caller releases the ownership only if the system call succeeds,
+        ///       so the body is destroyed in user space if no task control block is available or any initializer fails.
+        ///
+        template <typename Task>
+        requires TaskConstraints::TaskHasCoroutine<Task>
+        struct AssignCoroutine
+        {
+            /// Define the argument type
+            using Arg = void*;
+
+            ///
+            /// Assign the given coroutine body to the task
+            ///
+            /// @param task A non-null task control block
+            /// @param body The address of a coroutine body that has not started yet
+            /// @return `true` on success, `false` if the body is null.
+            ///
+            bool operator()(Task* task, void* body)
+            {
+                // Guard: The caller must transfer a valid body
+                if (body == nullptr)
+                {
+                    return false;
+                }
+
+                task->setCoroutine(Coroutine::Handle::from_address(body));
+
+                task->setWaitingForEvent(false);
+
+                return true;
+            }
+        };
+    }
+}
+
+/// Defines kernel service routines for the simple coroutine based execution model
+namespace KernelServiceRoutines::FinishCoroutine
+{
+    /// Private subroutine to finalize a task control block
+    namespace KPI
+    {
+        ///
+        /// [KPI] Private subroutine to destroy the coroutine body of a task
+        ///
+        /// @tparam Task Specify the type of a task that runs a coroutine body
+        /// @note Pass this finalizer to `FinishThread::ServiceRoutineBuilder` to release the frame of the body.
+        ///       The service routine runs on the kernel stack, so destroying the frame is safe even if the body has not returned.
+        ///
+        template <typename Task>
+        requires TaskConstraints::TaskHasCoroutine<Task>
+        struct DestroyCoroutine
+        {
+            ///
+            /// Destroy the coroutine body of the given task
+            ///
+            /// @param task A non-null task control block
+            ///
+            void operator()(Task* task)
+            {
+                Coroutine::Handle body = task->getCoroutine();
+
+                if (body)
+                {
+                    body.destroy();
+                }
+
+                task->setCoroutine(nullptr);
+            }
+        };
+    }
+}
+
+/// Defines kernel service routines for waiting for and sending events in the simple coroutine based execution model
+namespace KernelServiceRoutines::CoroutineEvent
+{
+    ///
+    /// Kernel service routine to suspend the current coroutine until an event is sent to it
+    ///
+    /// @tparam Task Specify the type of the task control block that runs a coroutine body and counts pending events
+    /// @tparam TaskScheduler Specify the type of the scheduler that provides the task termination handler
+    /// @tparam Log Specify the logging policy
+    /// @note The kernel return value is the number of events consumed by the wait.
+    ///       If events are already pending, the coroutine resumes immediately via the fast return path.
+    ///       Otherwise, the coroutine is removed from the scheduler and its frame stays suspended until `SyscallSendEvent`,
+    ///       so a waiting task costs nothing but its frame and its task control block.
+    ///
+    template <typename Task, typename TaskScheduler, typename Log = DefaultExecutionLog>
+    requires TaskConstraints::TaskHasCoroutine<Task> &&
+             TaskConstraints::TaskCoalescesEvents<Task> &&
+             TaskConstraints::TaskCanInvokeSystemCall<Task> &&
+             Scheduler::ProvidesTaskTerminationHandler<TaskScheduler, Task>
+    struct SyscallWaitEvent
+    {
+        Task* operator()(Task* task)
+        {
+            auto events = task->takePendingEvents();
+
+            // Guard: Events have been sent before the task waits for them
+            if (events != 0)
+            {
+                task->setSyscallKernelReturnValue(static_cast<int>(events));
+
+                return task;
+            }
+
+            if constexpr (Log::kInfo)
+            {
+                pinfo("Task at 0x%p is waiting for an event.", task);
+            }
+
+            task->setWaitingForEvent(true);
+
+            return GetTaskScheduler<TaskScheduler>().onTaskFinished(task);
+        }
+    };
+
+    ///
+    /// Kernel service routine to send an event to the coroutine that waits for it
+    ///
+    /// @tparam Task Specify the type of the task control block that runs a coroutine body and counts pending events
+    /// @tparam TaskScheduler Specify the type of the scheduler that provides the task creation handler
+    /// @tparam TaskMapper Specify the type of the functor that maps an event to its waiting task
+    /// @tparam Log Specify the logging policy
+    /// @note System call arguments: the event number.
+    /// @note The event is counted on the waiting task.
+    ///       If the task is waiting, it consumes all pending events and is admitted to the scheduler again,
+    ///       which may preempt the current task, just like an event handler in the event driven model.
+    ///
+    template <typename Task, typename TaskScheduler, typename TaskMapper, typename Log = DefaultExecutionLog>
+    requires TaskConstraints::TaskHasCoroutine<Task> &&
+             TaskConstraints::TaskCoalescesEvents<Task> &&
+             TaskConstraints::TaskProvidesIndexedSyscallArgumentsAccess<Task> &&
+             Scheduler::ProvidesTaskCreationHandler<TaskScheduler, Task>
+    struct SyscallSendEvent
+    {
+        Task* operator()(Task* task)
+        {
+            auto event = task->template getSyscallArgument<int, 0>();
+
+            Task* waiter = TaskMapper{}(event);
+
+            Log::trace(ExecutionTraceEvent::EventSent, TraceWord(task), TraceWord(waiter));
+
+            waiter->addPendingEvent();
+
+            task->setSyscallKernelReturnValue(0);
+
+            // Guard: The waiting task is running or ready, so it consumes the event in its next wait
+            if (!waiter->isWaitingForEvent())
+            {
+                return task;
+            }
+
+            if constexpr (Log::kInfo)
+            {
+                pinfo("Task at 0x%p has resumed the waiting task at 0x%p with the event %d.", task, waiter, event);
+            }
+
+            waiter->setWaitingForEvent(false);
+
+            waiter->setSyscallKernelReturnValue(static_cast<int>(waiter->takePendingEvents()));
+
+            return GetTaskScheduler<TaskScheduler>().onTaskCreated(task, waiter);
+        }
+    };
+}
+
+#endif /* Execution_SimpleCoroutineBasedKernelServiceRoutines_hpp */
@@ -0,0 +1,57 @@
+//
+//  Syscall.hpp
+//  Execution
+//
+//  Created by FireWolf on 2026-10-14.
+//
+
+#ifndef Execution_SimpleCoroutineBasedSyscall_hpp
+#define Execution_SimpleCoroutineBasedSyscall_hpp
+
+#include <Types.hpp>
+#include <utility>
+#include "Coroutine.hpp"
+
+// The kernel must implement the following system calls and assign an identifier to each of them
+// Each system call returns an awaiter that must be awaited by the caller, e.g. `co_await sysWaitEvent<kWaitEvent>()`
+
+///
+/// [SYSCALL] Create a coroutine task
+///
+/// @tparam Identifier Specify the system call identifier
+/// @param body The body of the new task, whose ownership is transferred to the kernel only if the task is created
+/// @param identifier The task identifier
+/// @return An awaiter that produces 0 on success, -1 otherwise.
+///
+template <UInt32 Identifier>
+static inline CoroutineCreationAwaiter<Identifier> sysCreateCoroutine(Coroutine&& body, UInt32 identifier)
+{
+    return CoroutineCreationAwaiter<Identifier>(std::move(body), identifier);
+}
+
+///
+/// [SYSCALL] Suspend the current coroutine task until an event is sent to it
+///
+/// @tparam Identifier Specify the system call identifier
+/// @return An awaiter that produces the number of events consumed by the wait.
+///
+template <UInt32 Identifier>
+static inline CoroutineSyscallAwaiter<Identifier> sysWaitEvent()
+{
+    return CoroutineSyscall<Identifier>();
+}
+
+///
+/// [SYSCALL] Send an event to the coroutine task that waits for it
+///
+/// @tparam Identifier Specify the system call identifier
+/// @param event The event number
+/// @return An awaiter that produces 0.
+///
+template <UInt32 Identifier>
+static inline CoroutineSyscallAwaiter<Identifier, int> sysSendEvent(int event)
+{
+    return CoroutineSyscall<Identifier>(event);
+}
+
+#endif /* Execution_SimpleCoroutineBasedSyscall_hpp */
@@ -9,8 +9,26 @@
 #define Execution_EventHandlerTrampoline_hpp
 
 #include <Debug.hpp>
+#include <Execution/Common/ExecutionLog.hpp>
+#include <Execution/Common/TaskConstraints.hpp>
 #include "Syscall.hpp"
 
+///
+/// Private helper to take the events coalesced into the activation of the handler whose context is about to be built
+///
+/// @param next The task whose handler is about to start
+/// @note The kernel takes the counter before the context builder runs, so events sent while the handler is running activate it again,
+///       and the context builder passes `next->getActivatedEvents()` to the handler without knowing about coalescing.
+///
+template <typename Task>
+static inline void TakeCoalescedEvents(Task* next)
+{
+    if constexpr (TaskConstraints::TaskCoalescesEvents<Task>)
+    {
+        next->takePendingEvents();
+    }
+}
+
 ///
 /// A code injector for the dispatcher to setup the execution context (if necessary) for a **preemptive** event handler that is selected to run
 ///
@@ -19,8 +37,9 @@
 ///       This injector also assumes that event handlers are one-shot and will run to completion without blocking.
 /// @note Kernel developers must implement the architecture-dependent context builder.
 ///       The context builder should implement the operator `()` that has the same signature as this functor.
+/// @note Developers can specify the logging policy via `Log`.
 ///
-template <typename Task, typename ContextBuilder>
+template <typename Task, typename ContextBuilder, typename Log = DefaultExecutionLog>
 struct PreemptiveEventHandlerTrampolineContextInjector
 {
     void operator()(Task* prev, Task* next)
@@ -29,7 +48,14 @@ struct PreemptiveEventHandlerTrampolineContextInjector
         // Only a high priority handler can preempt a lower one
         if (*next > *prev)
         {
-            pinfo("The next event handler has a higher priority than the previous one.");
+            if constexpr (Log::kInfo)
+            {
+                pinfo("The next event handler has a higher priority than the previous one.");
+            }
+
+            Log::trace(ExecutionTraceEvent::EventHandlerContextBuilt, TraceWord(prev), TraceWord(next));
+
+            TakeCoalescedEvents(next);
 
             ContextBuilder{}(prev, next);
         }
@@ -44,8 +70,9 @@ struct PreemptiveEventHandlerTrampolineContextInjector
 ///       This injector also assumes that event handlers are one-shot and will run to completion without blocking.
 /// @note Kernel developers must implement the architecture-dependent context builder.
 ///       The context builder should implement the operator `()` that has the same signature as this functor.
+/// @note Developers can specify the logging policy via `Log`.
 ///
-template <typename Task, typename ContextBuilder>
+template <typename Task, typename ContextBuilder, typename Log = DefaultExecutionLog>
 struct CooperativeEventHandlerTrampolineContextInjector
 {
     void operator()(Task* prev, Task* next)
@@ -53,14 +80,71 @@ struct CooperativeEventHandlerTrampolineContextInjector
         // Guard: Build the context if and only if the next task is not the current one
         if (next != prev)
         {
-            // The previous
-            pinfo("The next event handler is not the same as the previous one.");
+            if constexpr (Log::kInfo)
+            {
+                pinfo("The next event handler is not the same as the previous one.");
+            }
+
+            Log::trace(ExecutionTraceEvent::EventHandlerContextBuilt, TraceWord(prev), TraceWord(next));
+
+            TakeCoalescedEvents(next);
 
             ContextBuilder{}(prev, next);
         }
     }
 };
 
+///
+/// A code injector for the dispatcher to setup the execution context (if necessary) for an event handler that is selected to run
+///
+/// @note This injector setups the context for the next task if and only if its handler is not active,
+///       i.e. it has neither been preempted nor been tail-chained into the current activation.
+///       The scheduler has already decided whether the next task may preempt the previous one.
+/// @note This injector is required by `SyscallEventHandlerReturnWithTailChaining`,
+///       which marks a tail-chained handler as active, so that its context is not built again.
+/// @note The kernel must invoke `adopt()` on the initial task passed to the dispatcher as the interrupted one, typically the idle task,
+///       before the dispatcher starts. Otherwise, the initial task is inactive like a handler that has not started yet,
+///       and its saved context is never resumed once the last handler returns.
+/// @note Kernel developers must implement the architecture-dependent context builder.
+///       The context builder should implement the operator `()` that has the same signature as this functor.
+/// @note Developers can specify the logging policy via `Log`.
+///
+template <typename Task, typename ContextBuilder, typename Log = DefaultExecutionLog>
+requires TaskConstraints::TaskTracksEventHandlerActivation<Task>
+struct ActivationTrackingEventHandlerTrampolineContextInjector
+{
+    void operator()(Task* prev, Task* next)
+    {
+        // Guard: Build the context if and only if the next handler has not started yet
+        if (!next->isActive())
+        {
+            if constexpr (Log::kInfo)
+            {
+                pinfo("The next event handler has not started yet.");
+            }
+
+            Log::trace(ExecutionTraceEvent::EventHandlerContextBuilt, TraceWord(prev), TraceWord(next));
+
+            next->setActive(true);
+
+            TakeCoalescedEvents(next);
+
+            ContextBuilder{}(prev, next);
+        }
+    }
+
+    ///
+    /// Mark the given task that already has an execution context as active
+    ///
+    /// @param task A non-null task that is not an event handler, e.g. the initial or the idle task
+    /// @note The task is then resumed rather than tail-chained or given a new handler context when it is selected to run.
+    ///
+    static void adopt(Task* task)
+    {
+        task->setActive(true);
+    }
+};
+
 /// Private trampoline function to bootstrap the event handler
 /// The trampoline ensures that the control is handed back to kernel after the event handler finishes
 static void EventHandlerTrampoline(void (*handler)(), uint8_t* oldStack)
@@ -70,4 +154,61 @@ static void EventHandlerTrampoline(void (*handler)(), uint8_t* oldStack)
     sysEventHandlerReturn(oldStack);
 }
 
+///
+/// Private trampoline function to bootstrap the event handler that receives the message attached to the event
+///
+/// @tparam Message Specify the type of the message
+/// @param handler The event handler
+/// @param message The message owned by the kernel message pool, i.e. `task->getEventMessage()`
+/// @param oldStack The old stack pointer
+/// @note The context builder passes the message to the trampoline in place of copying it to the handler stack.
+///       The message remains valid until the handler returns, after which the kernel recycles it.
+///
+template <typename Message>
+static void EventHandlerTrampolineWithMessage(void (*handler)(Message*), Message* message, uint8_t* oldStack)
+{
+    handler(message);
+
+    sysEventHandlerReturn(oldStack);
+}
+
+///
+/// Private trampoline function to bootstrap the event handler that coalesces repeated events
+///
+/// @tparam Counter Specify the type of the pending event counter
+/// @param handler The event handler
+/// @param count The number of events coalesced into this activation, i.e. `task->getActivatedEvents()`
+/// @param oldStack The old stack pointer
+/// @note The context injector takes the counter before the context builder runs,
+///       so that events sent while the handler is running activate it again.
+///
+template <typename Counter>
+static void EventHandlerTrampolineWithCount(void (*handler)(Counter), Counter count, uint8_t* oldStack)
+{
+    handler(count);
+
+    sysEventHandlerReturn(oldStack);
+}
+
+///
+/// Private trampoline function to bootstrap the event handler that tail-chains pending handlers
+///
+/// @param handler The event handler
+/// @param oldStack The old stack pointer
+/// @note If the kernel selects a handler that has not started yet when the current one returns,
+///       the kernel hands the new handler back to the trampoline, which calls it in the same frame,
+///       so neither the stack pointer is restored nor a new context is built.
+///       Otherwise, the system call does not return.
+/// @note Handlers that coalesce events or receive a message take arguments and thus cannot be tail-chained.
+/// @see `SyscallEventHandlerReturnWithTailChaining` for details.
+///
+static void EventHandlerTrampolineWithTailChaining(void (*handler)(), uint8_t* oldStack)
+{
+    do
+    {
+        handler();
+    }
+    while (sysEventHandlerReturnAndChain(oldStack, &handler) != 0);
+}
+
 #endif /* Execution_EventHandlerTrampoline_hpp */
@@ -11,7 +11,13 @@
 #include <Scheduler/Scheduler.hpp>
 #include <Execution/Common/TaskConstraints.hpp>
 #include <Execution/Common/KernelServiceRoutines.hpp>
+#include <Execution/Common/ExecutionLog.hpp>
+#include <Execution/Common/Mailbox.hpp>
+#include <Execution/Common/MessagePool.hpp>
+#include <Execution/Common/PerCore.hpp>
+#include <algorithm>
 #include <array>
+#include <bit>
 
 template <typename Task, typename Event, size_t NumTasks>
 requires std::unsigned_integral<Event>
@@ -21,17 +27,419 @@ private:
     Task tasks[NumTasks];
 
 public:
-    void registerEvent(Event event, EventHandler handler)
+    void registerEvent(Event event, typename Task::EventHandlerType handler)
     {
         this->tasks[event].setHandler(handler);
     }
 
-    EventControlBlock* getRegisteredEvent(Event event)
+    Task* getRegisteredEvent(Event event)
     {
         return &this->tasks[event];
     }
 };
 
+///
+/// An event controller that tracks pending events in a two-level bitmap alongside the handler table
+///
+/// @tparam Task Specify the type of the event handler control block
+/// @tparam Event Specify the type of the event number
+/// @tparam NumTasks Specify the number of events; Must not exceed 1024
+/// @note The event number doubles as the priority of its handler, i.e. a larger event number has a higher priority.
+/// @note Each bit in the summary word is set if the corresponding word in the bitmap has a pending event,
+///       so finding the highest pending event takes two count-leading-zeros instructions regardless of the number of events.
+/// @note Developers can use this controller in place of `TableBasedEventController`.
+///       A scheduler can keep pending state here instead of scanning its own queue.
+///
+template <typename Task, typename Event, size_t NumTasks>
+requires std::unsigned_integral<Event> && (NumTasks > 0) && (NumTasks <= 32 * 32)
+struct BitmapEventController
+{
+private:
+    /// The number of words in the bitmap
+    static constexpr size_t kNumWords = (NumTasks + 31) / 32;
+
+    /// Handlers indexed by the event number
+    Task tasks[NumTasks];
+
+    /// The bit `n % 32` of the word `n / 32` is set if the event `n` is pending
+    UInt32 pending[kNumWords] = {};
+
+    /// The bit `n` is set if the word `n` of the bitmap is not zero
+    UInt32 summary = 0;
+
+    /// Private helper to get the index of the highest set bit in a non-zero word
+    static inline UInt32 highestBit(UInt32 word)
+    {
+        return 31 - std::countl_zero(word);
+    }
+
+public:
+    void registerEvent(Event event, typename Task::EventHandlerType handler)
+    {
+        this->tasks[event].setHandler(handler);
+    }
+
+    Task* getRegisteredEvent(Event event)
+    {
+        return &this->tasks[event];
+    }
+
+    ///
+    /// Get the event number of the given handler
+    ///
+    /// @param task A handler returned by `getRegisteredEvent()`
+    /// @return The event number of the handler.
+    ///
+    Event getEventNumber(const Task* task) const
+    {
+        return static_cast<Event>(task - this->tasks);
+    }
+
+    ///
+    /// Mark the given event as pending
+    ///
+    /// @param event The event number
+    ///
+    void setPending(Event event)
+    {
+        this->pending[event / 32] |= UInt32{1} << (event % 32);
+
+        this->summary |= UInt32{1} << (event / 32);
+    }
+
+    ///
+    /// Mark the given event as no longer pending
+    ///
+    /// @param event The event number
+    ///
+    void clearPending(Event event)
+    {
+        UInt32& word = this->pending[event / 32];
+
+        word &= ~(UInt32{1} << (event % 32));
+
+        // Clear the summary bit without a branch if the word becomes zero
+        this->summary &= ~(UInt32{word == 0} << (event / 32));
+    }
+
+    ///
+    /// Check whether the given event is pending
+    ///
+    /// @param event The event number
+    /// @return `true` if the event is pending, `false` otherwise.
+    ///
+    bool isPending(Event event) const
+    {
+        return (this->pending[event / 32] >> (event % 32)) & 1;
+    }
+
+    ///
+    /// Check whether any event is pending
+    ///
+    /// @return `true` if at least one event is pending, `false` otherwise.
+    ///
+    bool hasPendingEvents() const
+    {
+        return this->summary != 0;
+    }
+
+    ///
+    /// Get the pending event that has the highest priority
+    ///
+    /// @return The handler of the highest pending event, `nullptr` if no event is pending.
+    ///
+    Task* getHighestPendingEvent()
+    {
+        if (this->summary == 0)
+        {
+            return nullptr;
+        }
+
+        UInt32 index = highestBit(this->summary);
+
+        return &this->tasks[index * 32 + highestBit(this->pending[index])];
+    }
+};
+
+///
+/// Bind a hardware interrupt request to an event
+///
+/// @tparam IRQ Specify the interrupt request number
+/// @tparam Event Specify the event number sent when the interrupt fires
+///
+template <UInt32 IRQ, int Event>
+requires (Event >= 0)
+struct InterruptEventBinding
+{
+    /// The interrupt request number
+    static constexpr UInt32 kInterrupt = IRQ;
+
+    /// The event number
+    static constexpr int kEvent = Event;
+};
+
+///
+/// A compile-time table that maps hardware interrupt requests to events
+///
+/// @tparam Bindings Specify one or more `InterruptEventBinding`, each of which binds a distinct interrupt request
+/// @example Bind the timer interrupt and the UART interrupt to the event 3 and 5 respectively:
+///          `using Table = InterruptEventTable<InterruptEventBinding<29, 3>, InterruptEventBinding<57, 5>>;`
+///
+template <typename... Bindings>
+requires (sizeof...(Bindings) > 0)
+struct InterruptEventTable
+{
+    /// The event number of an interrupt request that is not bound to any event
+    static constexpr int kNoEvent = -1;
+
+    /// The number of entries in the table, i.e. the largest bound interrupt request number plus one
+    static constexpr size_t kNumInterrupts = std::max({ static_cast<size_t>(Bindings::kInterrupt)... }) + 1;
+
+private:
+    /// Private helper to build the table
+    static constexpr std::array<int, kNumInterrupts> build()
+    {
+        std::array<int, kNumInterrupts> events = {};
+
+        events.fill(kNoEvent);
+
+        ((events[Bindings::kInterrupt] = Bindings::kEvent), ...);
+
+        return events;
+    }
+
+    /// Events indexed by the interrupt request number
+    static constexpr std::array<int, kNumInterrupts> events = build();
+
+    static_assert(((events[Bindings::kInterrupt] == Bindings::kEvent) && ...), "An interrupt request is bound to more than one event.");
+
+public:
+    /// The event number bound to the given interrupt request
+    template <UInt32 IRQ>
+    requires (IRQ < kNumInterrupts) && (events[IRQ] != kNoEvent)
+    static constexpr int kEventOf = events[IRQ];
+
+    ///
+    /// Get the event number bound to the given interrupt request
+    ///
+    /// @param irq The interrupt request number
+    /// @return The event number on success, `kNoEvent` if the interrupt request is not bound to any event.
+    ///
+    static constexpr int lookup(UInt32 irq)
+    {
+        return irq < kNumInterrupts ? events[irq] : kNoEvent;
+    }
+};
+
+///
+/// Per-core mailboxes that deliver event handlers to other cores
+///
+/// @tparam Task Specify the type of the event handler control block
+/// @tparam Provider Specify the provider of the current core identifier
+/// @tparam Capacity Specify the maximum number of pending events per core; Must be a power of two
+/// @note Each core owns a mailbox in its own cache line.
+///       Any core can post to the mailbox of any core, but only the owner drains its mailbox.
+///
+template <typename Task, CoreIdentifierProvider Provider, size_t Capacity>
+struct EventMailboxes
+{
+    /// The type of the mailbox owned by each core
+    using Mailbox = MPSCMailbox<Task*, Capacity>;
+
+private:
+    /// The mailbox owned by each core
+    static inline PerCoreStorage<Mailbox, Provider> mailboxes;
+
+public:
+    ///
+    /// Get the mailbox owned by the given core
+    ///
+    /// @param core The core identifier
+    /// @return A reference to the mailbox owned by the given core.
+    ///
+    static Mailbox& onCore(size_t core)
+    {
+        return mailboxes[core];
+    }
+
+    ///
+    /// Get the mailbox owned by the current core
+    ///
+    /// @return A reference to the mailbox owned by the current core.
+    ///
+    static Mailbox& current()
+    {
+        return mailboxes.current();
+    }
+};
+
+/// Specify the constraint of the architecture-dependent functor that raises an inter-processor interrupt
+template <typename IPI>
+concept InterProcessorInterruptRaiser = requires(size_t core)
+{
+    ///
+    /// The functor can be initialized with zero arguments
+    ///
+    requires std::default_initializable<IPI>;
+
+    ///
+    /// The functor must implement the operator `()` that raises an interrupt on the given core
+    ///
+    { IPI{}(core) } -> std::same_as<void>;
+};
+
+///
+/// Specify the constraint of a scheduler lock that defers the preemption of the current task
+///
+template <typename Lock, typename Task>
+concept SchedulerLock = requires(Task* current)
+{
+    ///
+    /// The lock must implement the static function that disables the preemption
+    ///
+    { Lock::lock() } -> std::same_as<void>;
+
+    ///
+    /// The lock must implement the static function that enables the preemption and returns the next task that is selected to run
+    ///
+    { Lock::unlock(current) } -> std::same_as<Task*>;
+};
+
+///
+/// A scheduler lock that defers the preemption caused by sending events
+///
+/// @tparam Task Specify the type of the event handler control block
+/// @tparam TaskScheduler Specify the type of the scheduler that provides the task creation handler
+/// @tparam Capacity Specify the maximum number of event handlers deferred in a window
+/// @note This lock is a stateless adapter that can be passed as the task scheduler of event service routines.
+///       While a task holds the lock, handlers of sent events are only queued and the sender keeps running,
+///       so a burst of events does not preempt the sender and build a handler context for each of them.
+///       When the outermost window ends, queued handlers are handed to the scheduler in one call,
+///       and the dispatcher builds at most one handler context for the scheduling decision.
+/// @note The window is entered by `SyscallPreemptDisable` and left by `SyscallPreemptEnable`, which may be nested.
+///       A handler that enters the window must leave it before it returns.
+/// @note Events raised by interrupts are deferred as well, as long as the interrupt service routine sends events via this lock.
+/// @note If more than `Capacity` handlers are deferred, queued handlers are handed to the scheduler early,
+///       in which case the current task may be preempted inside the window.
+///       Pick a capacity no less than the number of event handlers, or let handlers coalesce events.
+///
+template <typename Task, typename TaskScheduler, size_t Capacity = 32>
+requires Scheduler::ProvidesTaskCreationHandler<TaskScheduler, Task> && (Capacity > 0)
+struct EventPreemptionLock
+{
+private:
+    /// The number of nested windows
+    static inline UInt32 depth = 0;
+
+    /// Event handlers whose admission is deferred until the window ends
+    static inline Task* deferred[Capacity];
+
+    /// The number of deferred handlers
+    static inline size_t count = 0;
+
+    /// Private helper to hand all deferred handlers to the scheduler
+    static Task* release(Task* current)
+    {
+        // Guard: No event has been sent in the window
+        if (count == 0)
+        {
+            return current;
+        }
+
+        Task* next = KernelServiceRoutines::NotifyTasksCreated<TaskScheduler>(current, deferred, count);
+
+        count = 0;
+
+        return next;
+    }
+
+public:
+    ///
+    /// Check whether the preemption is disabled
+    ///
+    /// @return `true` if a task holds the lock, `false` otherwise.
+    ///
+    static bool isLocked()
+    {
+        return depth != 0;
+    }
+
+    ///
+    /// Disable the preemption caused by sending events
+    ///
+    static void lock()
+    {
+        depth += 1;
+    }
+
+    ///
+    /// Enable the preemption caused by sending events
+    ///
+    /// @param current The current running task
+    /// @return The next task that is selected to run once the outermost window ends, `current` otherwise.
+    ///
+    static Task* unlock(Task* current)
+    {
+        precondition(depth != 0, "The preemption has not been disabled.");
+
+        depth -= 1;
+
+        return depth == 0 ? release(current) : current;
+    }
+
+    ///
+    /// [Scheduler] Admit the handler of a sent event or defer it until the window ends
+    ///
+    /// @param current The current running task
+    /// @param task The event handler that is ready to run
+    /// @return The next task that is selected to run, which is always `current` inside the window.
+    ///
+    static Task* onTaskCreated(Task* current, Task* task)
+    {
+        // Guard: The preemption is enabled
+        if (depth == 0)
+        {
+            return KernelServiceRoutines::NotifyTaskCreated<TaskScheduler>(current, task);
+        }
+
+        // Guard: The queue is full, so hand queued handlers to the scheduler early
+        if (count == Capacity)
+        {
+            current = release(current);
+        }
+
+        deferred[count] = task;
+
+        count += 1;
+
+        return current;
+    }
+
+    ///
+    /// [Scheduler] Admit the handlers of sent events or defer them until the window ends
+    ///
+    /// @param current The current running task
+    /// @param tasks A non-null array of event handlers that are ready to run
+    /// @param num The number of handlers in the array
+    /// @return The next task that is selected to run, which is always `current` inside the window.
+    ///
+    static Task* onTasksCreated(Task* current, Task** tasks, size_t num)
+    {
+        // Guard: The preemption is enabled
+        if (depth == 0)
+        {
+            return KernelServiceRoutines::NotifyTasksCreated<TaskScheduler>(current, tasks, num);
+        }
+
+        for (size_t index = 0; index < num; index += 1)
+        {
+            current = onTaskCreated(current, tasks[index]);
+        }
+
+        return current;
+    }
+};
+
 /// Defines kernel service routines for the simple event driven execution model
 namespace KernelServiceRoutines
 {
@@ -52,16 +460,55 @@ namespace KernelServiceRoutines
         { Mapper{}(event) } -> std::same_as<Task*>;
     };
 
+    /// Private subroutines shared by kernel service routines
+    namespace KPI
+    {
+        ///
+        /// [KPI] Private helper to record a sent event and check whether the scheduler should be notified
+        ///
+        /// @tparam Log Specify the logging policy
+        /// @param sender The task that sends the event
+        /// @param handler The handler of the event
+        /// @return `true` if the scheduler should be notified, `false` if the event is coalesced into a pending one.
+        /// @note Events are coalesced only if the handler control block satisfies `TaskCoalescesEvents`.
+        ///
+        template <typename Log, typename Task>
+        static inline bool RecordSentEvent(Task* sender, Task* handler)
+        {
+            Log::trace(ExecutionTraceEvent::EventSent, TraceWord(sender), TraceWord(handler));
+
+            if constexpr (TaskConstraints::TaskCoalescesEvents<Task>)
+            {
+                // Guard: The handler is already pending, so the event only bumps its counter
+                if (!handler->addPendingEvent())
+                {
+                    if constexpr (Log::kInfo)
+                    {
+                        pinfo("The event is coalesced into the pending one.");
+                    }
+
+                    return false;
+                }
+            }
+
+            return true;
+        }
+    }
+
     ///
     /// Kernel service routine to handle the request of sending an event
     ///
     /// @tparam Task Specify the type of the task control block that provides sequential access to system call arguments
     /// @tparam TaskScheduler Specify the type of the scheduler that provides the task creation handler
+    /// @tparam TaskMapper Specify the type of the functor that maps an event to its handler control block
+    /// @tparam Log Specify the logging policy
     /// @note This handler will notify the scheduler that a new event has been created.
     ///       The scheduler will return the next task that is selected to run.
     ///       Depending upon the actual scheduling policy, the current running task may be preempted.
+    /// @note If the handler control block satisfies `TaskCoalescesEvents`,
+    ///       an event sent to a pending handler only bumps its counter and the scheduler is not notified.
     ///
-    template <typename Task, typename TaskScheduler, typename TaskMapper>
+    template <typename Task, typename TaskScheduler, typename TaskMapper, typename Log = DefaultExecutionLog>
     requires TaskConstraints::TaskProvidesSequentialSyscallArgumentsAccess<Task> &&
              Scheduler::ProvidesTaskCreationHandler<TaskScheduler, Task> &&
              Event2TaskMapper<TaskMapper, Task>
@@ -70,13 +517,529 @@ namespace KernelServiceRoutines
         Task* operator()(Task* task)
         {
             // Fetch the event number
-            // TODO: Fetch the event data???
+            // See `SyscallSendEventWithMessage` for events that carry data
             auto event = task->template getSyscallArgument<int>();
 
             // Send the event
-            pinfo("Task at 0x%p has requested to send the event %d.", task, event);
+            if constexpr (Log::kInfo)
+            {
+                pinfo("Task at 0x%p has requested to send the event %d.", task, event);
+            }
+
+            Task* handler = TaskMapper{}(event);
 
-            return GetTaskScheduler<TaskScheduler>().onTaskCreated(task, TaskMapper{}(event));
+            // Guard: The event is not coalesced into a pending one
+            if (!KPI::RecordSentEvent<Log>(task, handler))
+            {
+                return task;
+            }
+
+            return NotifyTaskCreated<TaskScheduler>(task, handler);
+        }
+    };
+
+    ///
+    /// Kernel service routine to handle a hardware interrupt by sending the bound event directly
+    ///
+    /// @tparam Task Specify the type of the event handler control block
+    /// @tparam TaskScheduler Specify the type of the scheduler that provides the task creation handler
+    /// @tparam TaskMapper Specify the type of the functor that maps an event to its handler control block
+    /// @tparam Event Specify the event number bound to the interrupt, e.g. `InterruptEventTable::kEventOf<IRQ>`
+    /// @tparam Log Specify the logging policy
+    /// @note The dispatcher routes the service identifier of each interrupt to the corresponding instantiation,
+    ///       so the event number is a compile-time constant and no system call argument is decoded.
+    ///       Pass `&HardwareInterruptRoutine<...>::route` to `StaticServiceRoutineTable` without defining a wrapper function.
+    /// @note Like `SyscallSendEvent`, the interrupted task may be preempted by the handler,
+    ///       and repeated interrupts are coalesced if the handler control block satisfies `TaskCoalescesEvents`.
+    ///
+    template <typename Task, typename TaskScheduler, typename TaskMapper, int Event, typename Log = DefaultExecutionLog>
+    requires Scheduler::ProvidesTaskCreationHandler<TaskScheduler, Task> &&
+             Event2TaskMapper<TaskMapper, Task> &&
+             (Event >= 0)
+    struct HardwareInterruptRoutine
+    {
+        Task* operator()(Task* task)
+        {
+            Task* handler = TaskMapper{}(Event);
+
+            // Guard: The event is not coalesced into a pending one
+            if (!KPI::RecordSentEvent<Log>(task, handler))
+            {
+                return task;
+            }
+
+            return NotifyTaskCreated<TaskScheduler>(task, handler);
+        }
+
+        ///
+        /// The kernel service routine that can be passed to the dispatcher directly
+        ///
+        /// @param task The interrupted task
+        /// @return The next task that is selected to run.
+        ///
+        static Task* route(Task* task)
+        {
+            return HardwareInterruptRoutine{}(task);
+        }
+    };
+
+    ///
+    /// Kernel service routine to handle the request of claiming a message slot from the kernel message pool
+    ///
+    /// @tparam Task Specify the type of the task control block that provides sequential access to system call arguments
+    /// @tparam MessagePool Specify the kernel message pool, e.g. `StaticMessagePool`
+    /// @tparam Log Specify the logging policy
+    /// @note System call arguments: the address at which the address of the claimed slot is stored.
+    /// @note The kernel return value is 0 on success and -1 if the pool is exhausted.
+    ///
+    template <typename Task, typename MessagePool, typename Log = DefaultExecutionLog>
+    requires TaskConstraints::TaskProvidesSequentialSyscallArgumentsAccess<Task> &&
+             TaskConstraints::TaskCanInvokeSystemCall<Task>
+    struct SyscallClaimEventMessage
+    {
+        Task* operator()(Task* task)
+        {
+            auto result = task->template getSyscallArgument<void**>();
+
+            auto message = MessagePool::allocate();
+
+            if (message == nullptr)
+            {
+                if constexpr (Log::kError)
+                {
+                    perr("The kernel message pool is exhausted.");
+                }
+
+                task->setSyscallKernelReturnValue(-1);
+
+                return task;
+            }
+
+            *result = message;
+
+            task->setSyscallKernelReturnValue(0);
+
+            return task;
+        }
+    };
+
+    ///
+    /// Kernel service routine to handle the request of sending an event that carries a message
+    ///
+    /// @tparam Task Specify the type of the event handler control block that has an event message
+    /// @tparam TaskScheduler Specify the type of the scheduler that provides the task creation handler
+    /// @tparam TaskMapper Specify the type of the functor that maps an event to its handler control block
+    /// @tparam MessagePool Specify the kernel message pool, e.g. `StaticMessagePool`
+    /// @tparam Log Specify the logging policy
+    /// @note System call arguments: the event number followed by a slot claimed by `SyscallClaimEventMessage`.
+    /// @note The slot is attached to the handler without copying the message,
+    ///       and is recycled by `SyscallEventHandlerReturnWithMessage` once the handler returns.
+    /// @note The kernel return value is 0 on success and -1 if the slot has not been claimed or the handler has a pending message,
+    ///       in which case the slot is recycled immediately if it belongs to the pool.
+    ///
+    template <typename Task, typename TaskScheduler, typename TaskMapper, typename MessagePool, typename Log = DefaultExecutionLog>
+    requires TaskConstraints::TaskProvidesSequentialSyscallArgumentsAccess<Task> &&
+             TaskConstraints::TaskCanInvokeSystemCall<Task> &&
+             TaskConstraints::TaskHasEventMessage<Task> &&
+             Scheduler::ProvidesTaskCreationHandler<TaskScheduler, Task> &&
+             Event2TaskMapper<TaskMapper, Task>
+    struct SyscallSendEventWithMessage
+    {
+        Task* operator()(Task* task)
+        {
+            using Message = typename Task::EventMessageType;
+
+            auto event = task->template getSyscallArgument<int>();
+
+            auto message = static_cast<Message*>(task->template getSyscallArgument<void*>());
+
+            // Guard: The message must be a slot claimed from the pool
+            if (!MessagePool::submit(message))
+            {
+                if constexpr (Log::kError)
+                {
+                    perr("Task at 0x%p has attached an invalid message to the event %d.", task, event);
+                }
+
+                task->setSyscallKernelReturnValue(-1);
+
+                return task;
+            }
+
+            Task* handler = TaskMapper{}(event);
+
+            // Guard: The handler can hold one message at a time
+            if (handler->getEventMessage() != nullptr)
+            {
+                if constexpr (Log::kError)
+                {
+                    perr("The handler of the event %d has a pending message. The event is dropped.", event);
+                }
+
+                MessagePool::release(message);
+
+                task->setSyscallKernelReturnValue(-1);
+
+                return task;
+            }
+
+            handler->setEventMessage(message);
+
+            Log::trace(ExecutionTraceEvent::EventSent, TraceWord(task), TraceWord(handler));
+
+            task->setSyscallKernelReturnValue(0);
+
+            return NotifyTaskCreated<TaskScheduler>(task, handler);
+        }
+    };
+
+    /// Private subroutines shared by kernel service routines
+    namespace KPI
+    {
+        ///
+        /// [KPI] Private helper to hand a batch of event handlers to the scheduler in one kernel entry
+        ///
+        /// @tparam Task Specify the type of the event handler control block
+        /// @tparam TaskScheduler Specify the type of the scheduler that provides the task creation handler
+        /// @tparam Log Specify the logging policy
+        /// @tparam BatchSize Specify the maximum number of handlers buffered before the scheduler is notified
+        /// @note If the scheduler satisfies `SchedulerProvidesBatchTaskCreationHandler`,
+        ///       handlers are buffered and the scheduler selects the next task once per batch.
+        ///       Otherwise, each handler is passed to the scheduler as soon as it is added,
+        ///       while the previously selected task is considered as the running one.
+        ///
+        template <typename Task, typename TaskScheduler, typename Log, size_t BatchSize>
+        requires Scheduler::ProvidesTaskCreationHandler<TaskScheduler, Task> && (BatchSize > 0)
+        struct EventHandlerBatch
+        {
+        private:
+            /// `true` if the scheduler accepts a batch of new tasks
+            static constexpr bool kBatched = SchedulerProvidesBatchTaskCreationHandler<TaskScheduler, Task>;
+
+            /// The task that sends events
+            Task* sender;
+
+            /// The task that is currently selected to run
+            Task* next;
+
+            /// Handlers that have not been passed to the scheduler yet
+            Task* handlers[kBatched ? BatchSize : 1];
+
+            /// The number of buffered handlers
+            size_t count;
+
+            /// Private helper to pass buffered handlers to the scheduler
+            void flush()
+            {
+                if constexpr (kBatched)
+                {
+                    if (this->count != 0)
+                    {
+                        this->next = NotifyTasksCreated<TaskScheduler>(this->next, this->handlers, this->count);
+
+                        this->count = 0;
+                    }
+                }
+            }
+
+        public:
+            ///
+            /// Create an empty batch
+            ///
+            /// @param sender The task that sends events
+            ///
+            explicit EventHandlerBatch(Task* sender) : sender(sender), next(sender), handlers{}, count(0) {}
+
+            ///
+            /// Add the handler of a sent event to the batch
+            ///
+            /// @param handler A non-null event handler control block
+            ///
+            void add(Task* handler)
+            {
+                // Guard: The event is not coalesced into a pending one
+                if (!RecordSentEvent<Log>(this->sender, handler))
+                {
+                    return;
+                }
+
+                if constexpr (kBatched)
+                {
+                    this->handlers[this->count] = handler;
+
+                    this->count += 1;
+
+                    if (this->count == BatchSize)
+                    {
+                        this->flush();
+                    }
+                }
+                else
+                {
+                    this->next = NotifyTaskCreated<TaskScheduler>(this->next, handler);
+                }
+            }
+
+            ///
+            /// Pass all remaining handlers to the scheduler
+            ///
+            /// @return The next task that is selected to run.
+            ///
+            Task* finish()
+            {
+                this->flush();
+
+                return this->next;
+            }
+        };
+    }
+
+    ///
+    /// Kernel service routine to handle the request of sending multiple events in one system call
+    ///
+    /// @tparam Task Specify the type of the task control block that provides sequential access to system call arguments
+    /// @tparam TaskScheduler Specify the type of the scheduler that provides the task creation handler
+    /// @tparam TaskMapper Specify the type of the functor that maps an event to its handler control block
+    /// @tparam Log Specify the logging policy
+    /// @tparam BatchSize Specify the maximum number of handlers passed to a batch-capable scheduler at once
+    /// @note System call arguments: a pointer to the array of event numbers followed by the number of events.
+    /// @note Handlers are passed to the scheduler in the order of the array,
+    ///       and the current task is preempted at most once after all events have been sent.
+    ///
+    template <typename Task, typename TaskScheduler, typename TaskMapper, typename Log = DefaultExecutionLog, size_t BatchSize = 32>
+    requires TaskConstraints::TaskProvidesSequentialSyscallArgumentsAccess<Task> &&
+             Scheduler::ProvidesTaskCreationHandler<TaskScheduler, Task> &&
+             Event2TaskMapper<TaskMapper, Task>
+    struct SyscallSendEvents
+    {
+        Task* operator()(Task* task)
+        {
+            // Fetch the array of event numbers
+            auto events = task->template getSyscallArgument<const int*>();
+
+            auto count = task->template getSyscallArgument<size_t>();
+
+            if constexpr (Log::kInfo)
+            {
+                pinfo("Task at 0x%p has requested to send %d events.", task, static_cast<int>(count));
+            }
+
+            KPI::EventHandlerBatch<Task, TaskScheduler, Log, BatchSize> batch(task);
+
+            for (size_t index = 0; index < count; index += 1)
+            {
+                batch.add(TaskMapper{}(events[index]));
+            }
+
+            return batch.finish();
+        }
+    };
+
+    ///
+    /// Kernel service routine to handle the request of sending a set of events in one system call
+    ///
+    /// @tparam Task Specify the type of the task control block that provides sequential access to system call arguments
+    /// @tparam TaskScheduler Specify the type of the scheduler that provides the task creation handler
+    /// @tparam TaskMapper Specify the type of the functor that maps an event to its handler control block
+    /// @tparam Log Specify the logging policy
+    /// @note System call arguments: a mask in which the bit `n` is set if the event `n` should be sent.
+    /// @note Handlers are passed to the scheduler in the ascending order of event numbers,
+    ///       and the current task is preempted at most once after all events have been sent.
+    ///
+    template <typename Task, typename TaskScheduler, typename TaskMapper, typename Log = DefaultExecutionLog>
+    requires TaskConstraints::TaskProvidesSequentialSyscallArgumentsAccess<Task> &&
+             Scheduler::ProvidesTaskCreationHandler<TaskScheduler, Task> &&
+             Event2TaskMapper<TaskMapper, Task>
+    struct SyscallSendEventSet
+    {
+        Task* operator()(Task* task)
+        {
+            // Fetch the set of event numbers
+            auto events = task->template getSyscallArgument<UInt32>();
+
+            if constexpr (Log::kInfo)
+            {
+                pinfo("Task at 0x%p has requested to send the event set 0x%08x.", task, events);
+            }
+
+            // A set has at most 32 events, so the scheduler is notified at most once
+            KPI::EventHandlerBatch<Task, TaskScheduler, Log, 32> batch(task);
+
+            while (events != 0)
+            {
+                batch.add(TaskMapper{}(std::countr_zero(events)));
+
+                // Clear the lowest set bit
+                events &= events - 1;
+            }
+
+            return batch.finish();
+        }
+    };
+
+    ///
+    /// Kernel service routine to handle the request of sending an event to an event handler owned by the given core
+    ///
+    /// @tparam Task Specify the type of the task control block that can invoke system calls
+    /// @tparam TaskScheduler Specify the type of the scheduler that provides the task creation handler
+    /// @tparam TaskMapper Specify the type of the functor that maps an event to its handler control block
+    /// @tparam Provider Specify the provider of the current core identifier
+    /// @tparam Mailboxes Specify the per-core mailboxes, e.g. `EventMailboxes`
+    /// @tparam IPI Specify the functor that raises an inter-processor interrupt
+    /// @tparam Log Specify the logging policy
+    /// @note System call arguments: the event number followed by the target core identifier.
+    /// @note If the target core is the current core, this routine behaves the same as `SyscallSendEvent`, except that events are never coalesced.
+    ///       Otherwise, it posts the event handler to the mailbox of the target core,
+    ///       and raises an inter-processor interrupt only if the mailbox was empty,
+    ///       in which case the target core services the interrupt with `DrainEventMailbox`.
+    ///       The current task always continues to run.
+    /// @note The kernel return value is 0 on success and -1 if the target core does not exist or its mailbox is full.
+    ///
+    template <typename Task, typename TaskScheduler, typename TaskMapper, CoreIdentifierProvider Provider, typename Mailboxes, InterProcessorInterruptRaiser IPI, typename Log = DefaultExecutionLog>
+    requires TaskConstraints::TaskProvidesSequentialSyscallArgumentsAccess<Task> &&
+             TaskConstraints::TaskCanInvokeSystemCall<Task> &&
+             Scheduler::ProvidesTaskCreationHandler<TaskScheduler, Task> &&
+             Event2TaskMapper<TaskMapper, Task>
+    struct SyscallSendEventToCore
+    {
+        Task* operator()(Task* task)
+        {
+            // Fetch the event number and the target core
+            auto event = task->template getSyscallArgument<int>();
+
+            auto core = task->template getSyscallArgument<size_t>();
+
+            // Guard: The target core must exist
+            if (core >= Provider::kNumCores)
+            {
+                if constexpr (Log::kError)
+                {
+                    perr("The core %d does not exist. The event %d is dropped.", static_cast<int>(core), event);
+                }
+
+                task->setSyscallKernelReturnValue(-1);
+
+                return task;
+            }
+
+            Task* handler = TaskMapper{}(event);
+
+            Log::trace(ExecutionTraceEvent::EventSent, TraceWord(task), TraceWord(handler));
+
+            task->setSyscallKernelReturnValue(0);
+
+            // The event handler is owned by the current core
+            if (core == Provider::getCurrentCoreIdentifier())
+            {
+                return NotifyTaskCreated<TaskScheduler>(task, handler);
+            }
+
+            // Deliver the event handler to the target core
+            switch (Mailboxes::onCore(core).post(handler))
+            {
+                case MailboxPostResult::Full:
+                {
+                    if constexpr (Log::kError)
+                    {
+                        perr("The mailbox of the core %d is full. The event %d is dropped.", static_cast<int>(core), event);
+                    }
+
+                    task->setSyscallKernelReturnValue(-1);
+
+                    break;
+                }
+
+                case MailboxPostResult::PostedToEmptyMailbox:
+                {
+                    IPI{}(core);
+
+                    break;
+                }
+
+                case MailboxPostResult::Posted:
+                {
+                    break;
+                }
+            }
+
+            return task;
+        }
+    };
+
+    ///
+    /// Kernel service routine to handle the inter-processor interrupt that delivers events from other cores
+    ///
+    /// @tparam Task Specify the type of the task control block
+    /// @tparam TaskScheduler Specify the type of the scheduler that provides the task creation handler
+    /// @tparam Mailboxes Specify the per-core mailboxes, e.g. `EventMailboxes`
+    /// @note This routine drains the mailbox of the current core in a batch,
+    ///       and notifies the scheduler once per drained event handler.
+    ///
+    template <typename Task, typename TaskScheduler, typename Mailboxes>
+    requires Scheduler::ProvidesTaskCreationHandler<TaskScheduler, Task>
+    struct DrainEventMailbox
+    {
+        Task* operator()(Task* task)
+        {
+            // Each handler is created while the previously selected task is considered as the running one
+            Task* next = task;
+
+            Mailboxes::current().drain([&](Task* handler) -> void
+            {
+                next = NotifyTaskCreated<TaskScheduler>(next, handler);
+            });
+
+            return next;
+        }
+    };
+
+    ///
+    /// Kernel service routine to handle the request of disabling the preemption caused by sending events
+    ///
+    /// @tparam Task Specify the type of the task control block
+    /// @tparam Lock Specify the scheduler lock, e.g. `EventPreemptionLock`
+    /// @tparam Log Specify the logging policy
+    /// @note Event service routines must use the same lock as their task scheduler, so that handlers of sent events are deferred.
+    ///       The current task always continues to run.
+    ///
+    template <typename Task, typename Lock, typename Log = DefaultExecutionLog>
+    requires SchedulerLock<Lock, Task>
+    struct SyscallPreemptDisable
+    {
+        Task* operator()(Task* task)
+        {
+            if constexpr (Log::kInfo)
+            {
+                pinfo("Task at 0x%p has requested to disable the preemption.", task);
+            }
+
+            Lock::lock();
+
+            return task;
+        }
+    };
+
+    ///
+    /// Kernel service routine to handle the request of enabling the preemption caused by sending events
+    ///
+    /// @tparam Task Specify the type of the task control block
+    /// @tparam Lock Specify the scheduler lock, e.g. `EventPreemptionLock`
+    /// @tparam Log Specify the logging policy
+    /// @note When the outermost window ends, handlers of events sent in the window are handed to the scheduler in one call,
+    ///       so the current task is preempted at most once and the dispatcher builds at most one handler context.
+    ///
+    template <typename Task, typename Lock, typename Log = DefaultExecutionLog>
+    requires SchedulerLock<Lock, Task>
+    struct SyscallPreemptEnable
+    {
+        Task* operator()(Task* task)
+        {
+            if constexpr (Log::kInfo)
+            {
+                pinfo("Task at 0x%p has requested to enable the preemption.", task);
+            }
+
+            return Lock::unlock(task);
         }
     };
 
@@ -85,10 +1048,11 @@ namespace KernelServiceRoutines
     ///
     /// @tparam Task Specify the type of the task control block that provides sequential access to system call arguments and write access to the stack pointer
     /// @tparam TaskScheduler Specify the type of the scheduler that provides the task termination handler
+    /// @tparam Log Specify the logging policy
     /// @note This handler will restore the stack pointer for the task and notify the scheduler that the task has finished.
     /// @note This handler is designed for event handlers that share the same user stack.
     ///
-    template <typename Task, typename TaskScheduler>
+    template <typename Task, typename TaskScheduler, typename Log = DefaultExecutionLog>
     requires TaskConstraints::TaskProvidesSequentialSyscallArgumentsAccess<Task> &&
              TaskConstraints::TaskProvidesStackPointerWriteAccess<Task> &&
              Scheduler::ProvidesTaskTerminationHandler<TaskScheduler, Task>
@@ -101,10 +1065,119 @@ namespace KernelServiceRoutines
 
             task->setStackPointer(oldStackPointer);
 
-            pinfo("Task stack pointer has been restored to 0x%p.", oldStackPointer);
+            if constexpr (Log::kInfo)
+            {
+                pinfo("Task stack pointer has been restored to 0x%p.", oldStackPointer);
+            }
 
             // Fetch the next event handler
-            return GetTaskScheduler<TaskScheduler>().onTaskFinished(task);
+            Task* next = GetTaskScheduler<TaskScheduler>().onTaskFinished(task);
+
+            Log::trace(ExecutionTraceEvent::EventHandlerReturned, TraceWord(task), TraceWord(next));
+
+            return next;
+        }
+    };
+
+    ///
+    /// Kernel service routine to handle the task whose event handler has finished and tail-chain the next handler if possible
+    ///
+    /// @tparam Task Specify the type of the task control block that tracks the activation of its handler
+    /// @tparam TaskScheduler Specify the type of the scheduler that provides the task termination handler
+    /// @tparam Log Specify the logging policy
+    /// @note System call arguments: the old stack pointer followed by the address at which the next handler is stored.
+    /// @note If the scheduler selects a handler that has not started yet, the handler takes over the frame of the finished one:
+    ///       The stack pointer is not restored, the handler is stored to the trampoline and marked as active,
+    ///       so that `ActivationTrackingEventHandlerTrampolineContextInjector` does not build its context again.
+    ///       The kernel return value is 1 in this case, and the trampoline calls the handler directly.
+    /// @note Otherwise, e.g. the scheduler resumes a preempted handler or the interrupted idle task,
+    ///       this routine restores the stack pointer and behaves the same as `SyscallEventHandlerReturn`.
+    /// @note Tasks that are not event handlers must be marked as active before the dispatcher starts,
+    ///       e.g. with `ActivationTrackingEventHandlerTrampolineContextInjector::adopt()`, so that they are resumed rather than tail-chained.
+    /// @note A tail-chained handler bypasses the context builder and is called by `EventHandlerTrampolineWithTailChaining` without arguments,
+    ///       so handlers that coalesce events or receive a message cannot be tail-chained,
+    ///       since nothing would take their pending events or deliver and recycle their messages.
+    /// @note This is the software counterpart of the tail-chaining of exception handlers on Cortex-M processors.
+    ///
+    template <typename Task, typename TaskScheduler, typename Log = DefaultExecutionLog>
+    requires TaskConstraints::TaskProvidesSequentialSyscallArgumentsAccess<Task> &&
+             TaskConstraints::TaskCanInvokeSystemCall<Task> &&
+             TaskConstraints::TaskProvidesStackPointerReadAccess<Task> &&
+             TaskConstraints::TaskProvidesStackPointerWriteAccess<Task> &&
+             TaskConstraints::TaskTracksEventHandlerActivation<Task> &&
+             (!TaskConstraints::TaskCoalescesEvents<Task>) &&
+             (!TaskConstraints::TaskHasEventMessage<Task>) &&
+             Scheduler::ProvidesTaskTerminationHandler<TaskScheduler, Task>
+    struct SyscallEventHandlerReturnWithTailChaining
+    {
+        Task* operator()(Task* task)
+        {
+            auto oldStackPointer = task->template getSyscallArgument<UInt8*>();
+
+            auto result = task->template getSyscallArgument<typename Task::EventHandlerType*>();
+
+            task->setActive(false);
+
+            Task* next = GetTaskScheduler<TaskScheduler>().onTaskFinished(task);
+
+            Log::trace(ExecutionTraceEvent::EventHandlerReturned, TraceWord(task), TraceWord(next));
+
+            // Guard: The next handler has been preempted, so its context must be resumed
+            if (next->isActive())
+            {
+                task->setStackPointer(oldStackPointer);
+
+                if constexpr (Log::kInfo)
+                {
+                    pinfo("Task stack pointer has been restored to 0x%p.", oldStackPointer);
+                }
+
+                return next;
+            }
+
+            // Tail-chain the next handler in the current frame
+            if constexpr (Log::kInfo)
+            {
+                pinfo("The next event handler is tail-chained.");
+            }
+
+            next->setStackPointer(task->getStackPointer());
+
+            next->setActive(true);
+
+            *result = next->getHandler();
+
+            task->setSyscallKernelReturnValue(1);
+
+            return next;
+        }
+    };
+
+    ///
+    /// Kernel service routine to handle the task whose event handler has finished and recycle its message
+    ///
+    /// @tparam Task Specify the type of the task control block that has an event message
+    /// @tparam TaskScheduler Specify the type of the scheduler that provides the task termination handler
+    /// @tparam MessagePool Specify the kernel message pool, e.g. `StaticMessagePool`
+    /// @tparam Log Specify the logging policy
+    /// @note This handler recycles the message attached to the finished handler,
+    ///       and then behaves the same as `SyscallEventHandlerReturn`.
+    ///
+    template <typename Task, typename TaskScheduler, typename MessagePool, typename Log = DefaultExecutionLog>
+    requires TaskConstraints::TaskHasEventMessage<Task>
+    struct SyscallEventHandlerReturnWithMessage
+    {
+        Task* operator()(Task* task)
+        {
+            // Recycle the message
+            if (auto message = task->getEventMessage(); message != nullptr)
+            {
+                MessagePool::release(message);
+
+                task->setEventMessage(nullptr);
+            }
+
+            return SyscallEventHandlerReturn<Task, TaskScheduler, Log>{}(task);
         }
     };
 }
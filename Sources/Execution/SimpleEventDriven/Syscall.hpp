@@ -27,6 +27,67 @@ void sysSetEventHandler(int event, void(*handler)());
 ///
 void sysSendEvent(int event);
 
+///
+/// [SYSCALL] Claim a message slot from the kernel message pool
+///
+/// @param message Set to the address of the claimed slot on return, which the caller fills in place
+/// @return 0 on success, -1 if the pool is exhausted.
+///
+int sysClaimEventMessage(void** message);
+
+///
+/// [SYSCALL] Send an event that carries a message
+///
+/// @param event The event number
+/// @param message A slot claimed by `sysClaimEventMessage()`
+/// @return 0 on success, -1 if the message is invalid or the handler has a pending message.
+/// @note The handler receives the pointer to the same slot, which is recycled once the handler returns.
+///       The caller must not access the message after this system call, even if it fails.
+///
+int sysSendEventWithMessage(int event, void* message);
+
+///
+/// [SYSCALL] Send multiple events in one system call
+///
+/// @param events A non-null array of event numbers
+/// @param count The number of events in the array
+/// @note The current task is preempted at most once after all events have been sent.
+///
+void sysSendEvents(const int* events, size_t count);
+
+///
+/// [SYSCALL] Send a set of events in one system call
+///
+/// @param events A mask in which the bit `n` is set if the event `n` should be sent
+/// @note The current task is preempted at most once after all events have been sent.
+///
+void sysSendEventSet(UInt32 events);
+
+///
+/// [SYSCALL] Send an event to the event handler owned by the given core
+///
+/// @param event The event number
+/// @param core The identifier of the core that owns the event handler
+/// @return 0 on success, -1 if the event cannot be delivered to the given core.
+///
+int sysSendEventToCore(int event, size_t core);
+
+///
+/// [SYSCALL] Disable the preemption caused by sending events
+///
+/// @note Handlers of events sent afterwards are queued, and the current task keeps running until `sysPreemptEnable()`.
+///       Calls may be nested.
+///
+void sysPreemptDisable();
+
+///
+/// [SYSCALL] Enable the preemption caused by sending events
+///
+/// @note Handlers of events sent since the outermost `sysPreemptDisable()` are scheduled at once,
+///       so the current task is preempted at most once.
+///
+void sysPreemptEnable();
+
 ///
 /// [SYSCALL] Return from the event handler
 ///
@@ -35,4 +96,14 @@ void sysSendEvent(int event);
 ///
 void sysEventHandlerReturn(UInt8* oldStack);
 
+///
+/// [SYSCALL] Return from the event handler and tail-chain the next handler if possible
+///
+/// @param oldStack The old stack pointer
+/// @param handler Set to the next event handler on return if it is tail-chained
+/// @return A non-zero value if the next handler is tail-chained; Otherwise, this system call does not return.
+/// @note This is a private system call used by the tail-chaining trampoline function.
+///
+int sysEventHandlerReturnAndChain(UInt8* oldStack, void (**handler)());
+
 #endif /* Execution_SimpleEventDrivenSyscall_hpp */
@@ -11,6 +11,12 @@
 #include <Scheduler/Scheduler.hpp>
 #include <Execution/Common/TaskConstraints.hpp>
 #include <Execution/Common/KernelServiceRoutines.hpp>
+#include <Execution/Common/SyscallDescriptor.hpp>
+#include <Execution/Common/ExecutionLog.hpp>
+#include <Execution/Common/TimerWheel.hpp>
+#include <Execution/Common/Futex.hpp>
+#include "StackPool.hpp"
+#include "WorkStealingBalancer.hpp"
 
 /// Defines kernel service routines for the simple thread based execution model
 namespace KernelServiceRoutines::CreateThread
@@ -18,16 +24,53 @@ namespace KernelServiceRoutines::CreateThread
     /// Private subroutine to create and initialize a task control block
     namespace KPI
     {
+        ///
+        /// [KPI] Private helper to paint the stack assigned to a task
+        ///
+        /// @param task A non-null task control block
+        /// @param stack The start address of the stack
+        /// @param size The size of the stack in bytes
+        /// @note The stack is painted only if the task satisfies `TaskTracksStackUsage`.
+        ///       Stack initializers run before `SetupExecutionContext`, so the initial context is built on the painted stack.
+        ///
+        template <typename Task>
+        static inline void PaintStack(Task* task, UInt8* stack, size_t size)
+        {
+            if constexpr (TaskConstraints::TaskTracksStackUsage<Task>)
+            {
+                task->paintStack(stack, size);
+            }
+        }
+
+        ///
+        /// [KPI] Private helper to compute the memory protection regions for the stack assigned to a task
+        ///
+        /// @param task A non-null task control block
+        /// @param stack The start address of the stack
+        /// @param size The size of the stack in bytes
+        /// @note Regions are computed only if the task satisfies `TaskHasMemoryProtectionRegions`,
+        ///       so that `MemoryProtectionInjector` programs precomputed descriptors at each context switch.
+        ///
+        template <typename Task>
+        static inline void ProtectStack(Task* task, UInt8* stack, size_t size)
+        {
+            if constexpr (TaskConstraints::TaskHasMemoryProtectionRegions<Task>)
+            {
+                task->setMemoryRegions(stack, size);
+            }
+        }
+
         ///
         /// [KPI] Private subroutine to allocate a dedicated stack for a task dynamically
         ///
         /// @tparam Task Specify the type of a task that has a dedicated stack
+        /// @tparam Log Specify the logging policy
         /// @note This subroutine also adjusts task's stack pointer to the bottom of allocated stack.
         /// @note The kernel does not care about reclaiming the stack memory back.
         /// @example The kernel has a prior knowledge that each new tasks will never terminate.
         /// @seealso `AssignStack` if the kernel prefers to assign a pre-allocated stack for the task.
         ///
-        template <typename Task>
+        template <typename Task, typename Log = DefaultExecutionLog>
         requires TaskConstraints::TaskHasDedicatedStack<Task>
         struct AllocateDedicatedStack
         {
@@ -50,7 +93,16 @@ namespace KernelServiceRoutines::CreateThread
                     return false;
                 }
 
-                pinfo("Allocated stack starts at 0x%p, length = %d bytes.", stack, stackSize);
+                if constexpr (Log::kInfo)
+                {
+                    pinfo("Allocated stack starts at 0x%p, length = %d bytes.", stack, stackSize);
+                }
+
+                Log::trace(ExecutionTraceEvent::StackAllocated, TraceWord(task), stackSize);
+
+                PaintStack(task, stack, stackSize);
+
+                ProtectStack(task, stack, stackSize);
 
                 task->setStackPointer(stack + stackSize);
 
@@ -62,12 +114,13 @@ namespace KernelServiceRoutines::CreateThread
         /// [KPI] Private subroutine to allocate a dedicated recyclable stack for a task dynamically
         ///
         /// @tparam Task Specify the type of a task that has a dedicated stack
+        /// @tparam Log Specify the logging policy
         /// @note This subroutine also adjusts task's stack pointer to the bottom of allocated stack.
         /// @note The kernel is responsible for managing the memory of the stack.
         ///       Developers must include `ReleaseDedicatedStack` when building the finalizer for the `FinishThread` service routine.
         /// @seealso `AssignStack` if the kernel prefers to assign a pre-allocated stack for the task.
         ///
-        template <typename Task>
+        template <typename Task, typename Log = DefaultExecutionLog>
         requires TaskConstraints::TaskHasDedicatedRecyclableStack<Task>
         struct AllocateDedicatedRecyclableStack
         {
@@ -90,7 +143,16 @@ namespace KernelServiceRoutines::CreateThread
                     return false;
                 }
 
-                pinfo("Allocated stack starts at 0x%p, length = %d bytes.", stack, stackSize);
+                if constexpr (Log::kInfo)
+                {
+                    pinfo("Allocated stack starts at 0x%p, length = %d bytes.", stack, stackSize);
+                }
+
+                Log::trace(ExecutionTraceEvent::StackAllocated, TraceWord(task), stackSize);
+
+                PaintStack(task, stack, stackSize);
+
+                ProtectStack(task, stack, stackSize);
 
                 task->setPrivateStack(stack);
 
@@ -100,6 +162,134 @@ namespace KernelServiceRoutines::CreateThread
             }
         };
 
+        ///
+        /// [KPI] Private subroutine to allocate a dedicated recyclable stack for a task from a static pool
+        ///
+        /// @tparam Task Specify the type of a task that has a dedicated stack
+        /// @tparam StackSize Specify the size of each stack in the pool
+        /// @tparam Count Specify the number of stacks in the pool
+        /// @tparam Alignment Specify the alignment of each stack in the pool
+        /// @note This subroutine also adjusts task's stack pointer to the bottom of allocated stack.
+        /// @note Unlike `AllocateDedicatedRecyclableStack`, this subroutine does not touch the heap and takes constant time.
+        ///       Developers must include `ReleasePooledStack` with the same pool parameters
+        ///       when building the finalizer for the `FinishThread` service routine.
+        /// @note The argument is the requested stack size, so this subroutine is a drop-in replacement of `AllocateDedicatedRecyclableStack`.
+        ///       The allocation fails if the requested size exceeds the size of stacks in the pool.
+        /// @seealso `StaticStackPool` for details of the pool.
+        ///
+        template <typename Task, size_t StackSize, size_t Count, size_t Alignment = alignof(std::max_align_t)>
+        requires TaskConstraints::TaskHasDedicatedRecyclableStack<Task>
+        struct PooledStackAllocator
+        {
+            /// Define the argument type
+            using Arg = size_t;
+
+            /// The pool that provides stacks
+            using Pool = StaticStackPool<StackSize, Count, Alignment>;
+
+            ///
+            /// Allocate a private stack to the given task from the pool
+            ///
+            /// @param task A non-null task control block
+            /// @param stackSize The requested stack size
+            /// @return `true` on success, `false` if the requested size is too large or the pool is exhausted.
+            ///
+            bool operator()(Task* task, size_t stackSize)
+            {
+                // Guard: The requested size must fit in a stack in the pool
+                if (stackSize > StackSize)
+                {
+                    return false;
+                }
+
+                // Guard: Allocate a stack from the pool
+                UInt8* stack = Pool::allocate();
+
+                if (stack == nullptr)
+                {
+                    return false;
+                }
+
+                PaintStack(task, stack, StackSize);
+
+                ProtectStack(task, stack, StackSize);
+
+                task->setPrivateStack(stack);
+
+                task->setStackPointer(stack + StackSize);
+
+                return true;
+            }
+        };
+
+        ///
+        /// [KPI] Private subroutine to allocate a dedicated recyclable stack for a task from a pool of size classes
+        ///
+        /// @tparam Task Specify the type of a task that has a dedicated stack
+        /// @tparam Pool Specify the type of the size class stack pool
+        /// @note This subroutine also adjusts task's stack pointer to the bottom of allocated stack.
+        /// @note The argument is the requested stack size, and the pool picks the smallest class that fits it.
+        ///       Developers must include `ReleaseSizeClassStack` with the same pool
+        ///       when building the finalizer for the `FinishThread` service routine.
+        /// @seealso `SizeClassStackPool` for details of the pool.
+        /// @note If the task tracks stack usage, the stack is painted before the pool installs the guard, so painting never overwrites a canary.
+        ///       The painter must also reserve the guard, e.g. `StackUsageSupport<Task, StackPainter<0xA5, sizeof(UInt32)>>` for `StackCanaryGuard`,
+        ///       so that the guard is not reported as used stack; The compilation fails otherwise if both sizes are known.
+        ///
+        template <typename Task, typename Pool>
+        requires TaskConstraints::TaskHasDedicatedRecyclableStack<Task>
+        struct SizeClassStackAllocator
+        {
+            /// Define the argument type
+            using Arg = size_t;
+
+            ///
+            /// Allocate a private stack to the given task from the pool
+            ///
+            /// @param task A non-null task control block
+            /// @param stackSize The requested stack size
+            /// @return `true` on success, `false` if no size class can service the request.
+            ///
+            bool operator()(Task* task, size_t stackSize)
+            {
+                if constexpr (requires { Task::StackPainterType::kGuardSize; Pool::GuardType::kGuardSize; })
+                {
+                    static_assert(Task::StackPainterType::kGuardSize >= Pool::GuardType::kGuardSize,
+                                  "The stack painter must reserve the guard installed by the pool.");
+                }
+
+                // Paint the stack before the pool installs the guard at its limit
+                auto [stack, size] = Pool::allocate(stackSize, [task](UInt8* newStack, size_t newSize) -> void
+                {
+                    PaintStack(task, newStack, newSize);
+                });
+
+                if (stack == nullptr)
+                {
+                    return false;
+                }
+
+                ProtectStack(task, stack, size);
+
+                task->setPrivateStack(stack);
+
+                task->setStackPointer(stack + size);
+
+                return true;
+            }
+
+            ///
+            /// Check whether the given task has ever overflowed its private stack
+            ///
+            /// @param task A non-null task control block whose stack is allocated by this subroutine
+            /// @return `true` if the guard at the stack limit is intact, `false` otherwise.
+            ///
+            static bool isStackIntact(Task* task)
+            {
+                return Pool::isIntact(task->getPrivateStack());
+            }
+        };
+
         ///
         /// [KPI] Private subroutine to assign a pre-allocated stack to a task
         ///
@@ -125,6 +315,10 @@ namespace KernelServiceRoutines::CreateThread
             template <size_t N>
             bool operator()(Task* task, UInt8 (&stack)[N])
             {
+                PaintStack(task, stack, N);
+
+                ProtectStack(task, stack, N);
+
                 task->setPrivateStack(stack);
 
                 task->setStackPointer(stack + N);
@@ -158,6 +352,10 @@ namespace KernelServiceRoutines::CreateThread
             ///
             bool operator()(Task* task, std::pair<UInt8*, size_t> stack)
             {
+                PaintStack(task, stack.first, stack.second);
+
+                ProtectStack(task, stack.first, stack.second);
+
                 task->setPrivateStack(stack.first);
 
                 task->setStackPointer(stack.first + stack.second);
@@ -251,6 +449,33 @@ namespace KernelServiceRoutines::CreateThread
             }
         };
 
+        ///
+        /// [KPI] Private subroutine to assign a core affinity mask to a task
+        ///
+        /// @tparam Task Specify the type of a task that has a core affinity mask
+        ///
+        template <typename Task>
+        requires TaskConstraints::TaskHasCoreAffinity<Task>
+        struct AssignCoreAffinity
+        {
+            /// Define the argument type
+            using Arg = UInt32;
+
+            ///
+            /// Assign the given core affinity mask to the task
+            ///
+            /// @param task A non-null task control block
+            /// @param affinity The core affinity mask
+            /// @return `true` always.
+            ///
+            bool operator()(Task* task, UInt32 affinity)
+            {
+                task->setCoreAffinity(affinity);
+
+                return true;
+            }
+        };
+
         ///
         /// [KPI] Invoke a list of task control block initializers with supplied arguments
         ///
@@ -337,7 +562,7 @@ namespace KernelServiceRoutines::CreateThread
 
             // A new task has been created
             // Notify the scheduler
-            return GetTaskScheduler<TaskScheduler>().onTaskCreated(task, newTask);
+            return NotifyTaskCreated<TaskScheduler>(task, newTask);
         }
 
         ///
@@ -363,6 +588,8 @@ namespace KernelServiceRoutines::CreateThread
     /// @tparam TaskScheduler Specify the type of a task scheduler
     /// @tparam Initializers Specify zero or more task control block initializers
     /// @note This service routine is expected to be invoked in the kernel to service the system call.
+    /// @note If the task provides indexed access to system call arguments (e.g. `RegisterSyscallSupport`),
+    ///       this service routine reads all arguments directly from the saved register frame in a single pass.
     ///
     template <typename Task, typename TaskScheduler, typename TaskController, typename... Initializers>
     requires TaskConstraints::TaskCanInvokeSystemCall<Task> &&
@@ -371,6 +598,26 @@ namespace KernelServiceRoutines::CreateThread
     struct ServiceRoutineBuilderWithTaskArgs
     {
         Task* operator()(Task* task)
+        {
+            // Retrieve system call arguments from registers
+            // The accessor is stateless, so all arguments are fetched in a single pass regardless of the order of evaluation
+            if constexpr (TaskConstraints::TaskProvidesIndexedSyscallArgumentsAccess<Task>)
+            {
+                return [&]<std::size_t... I>(std::index_sequence<I...>) -> Task*
+                {
+                    return ServiceRoutineBuilder<Task, TaskScheduler, TaskController, Initializers...>::execute(task,
+                           task->template getSyscallArgument<typename std::tuple_element_t<I, std::tuple<Initializers...>>::Arg, I>()...);
+                }(std::index_sequence_for<Initializers...>());
+            }
+            else
+            {
+                return this->collectSequentialArguments(task);
+            }
+        }
+
+    private:
+        /// Private helper to retrieve system call arguments one by one via the stateful accessor
+        Task* collectSequentialArguments(Task* task)
         {
             // Guard: Retrieve system call arguments
             // We cannot simply do `std::invoke(ServiceRoutineBuilderWithArgs::execute, task->getSystemCallArgument<typename Initializers::Arg>()...)`,
@@ -388,10 +635,855 @@ namespace KernelServiceRoutines::CreateThread
             collector(std::index_sequence_for<Initializers...>());
 
             // Execute initializers with collected system call arguments
-            return std::apply(ServiceRoutineBuilder<Task, TaskScheduler, Initializers...>::execute,
+            return std::apply(ServiceRoutineBuilder<Task, TaskScheduler, TaskController, Initializers...>::template execute<typename Initializers::Arg...>,
                               std::tuple_cat(std::make_tuple(task), arguments));
         }
     };
+
+    ///
+    /// Build the kernel service routine that creates a new thread with arguments described by a typed system call
+    ///
+    /// @tparam Task Specify the type of a task control block
+    /// @tparam TaskScheduler Specify the type of a task scheduler
+    /// @tparam TaskController Specify the type of a task controller
+    /// @tparam Descriptor Specify the typed system call descriptor shared with the user stub
+    /// @tparam Initializers Specify zero or more task control block initializers
+    /// @note This service routine is expected to be invoked in the kernel to service the system call.
+    ///       It reads the argument list packed by the user stub in place and passes each argument to the corresponding initializer.
+    ///       The argument types declared by the descriptor must match those expected by initializers.
+    /// @seealso `Syscall` for details of the typed system call descriptor.
+    ///
+    template <typename Task, typename TaskScheduler, typename TaskController, typename Descriptor, typename... Initializers>
+    requires TaskConstraints::TaskCanInvokeSystemCall<Task> &&
+             Scheduler::ProvidesTaskCreationHandler<TaskScheduler, Task> &&
+             TaskControllerProvidesBasicAllocationSupport<TaskController> &&
+             std::same_as<typename Descriptor::Arguments, SyscallArguments<typename Initializers::Arg...>>
+    struct ServiceRoutineBuilderWithTypedArgs
+    {
+        Task* operator()(Task* task)
+        {
+            const typename Descriptor::Arguments* arguments = Descriptor::fetch(task);
+
+            return [&]<std::size_t... I>(std::index_sequence<I...>) -> Task*
+            {
+                return ServiceRoutineBuilder<Task, TaskScheduler, TaskController, Initializers...>::execute(task, arguments->template get<I>()...);
+            }(std::index_sequence_for<Initializers...>());
+        }
+    };
+
+    ///
+    /// Build the kernel service routine that creates multiple threads from an array of descriptors
+    ///
+    /// @tparam Task Specify the type of a task control block
+    /// @tparam TaskScheduler Specify the type of a task scheduler
+    /// @tparam TaskController Specify the type of a task controller
+    /// @tparam BatchSize Specify the maximum number of new threads handed to the scheduler at once
+    /// @tparam Initializers Specify zero or more task control block initializers
+    /// @note Each descriptor packs the arguments of initializers in order, e.g. the entry point, the stack, the priority and the identifier,
+    ///       with the same layout as a typed system call argument list, so the user space and the kernel share the array as is.
+    /// @note This service routine allocates task control blocks for a batch first, runs initializers in a tight loop,
+    ///       and then hands the batch to the scheduler in one call if it satisfies `SchedulerProvidesBatchTaskCreationHandler`,
+    ///       so the scheduler re-evaluates the preemption once per batch instead of once per thread.
+    ///       Otherwise, the scheduler or the adapter is notified of each new thread in turn.
+    /// @note Threads are created in order and the routine stops at the first failure.
+    ///       The kernel return value is the number of threads created, which are all admitted to the scheduler.
+    /// @note This service routine is expected to be invoked at kernel initialization time or by the initial thread.
+    ///
+    template <typename Task, typename TaskScheduler, typename TaskController, size_t BatchSize, typename... Initializers>
+    requires TaskConstraints::TaskCanInvokeSystemCall<Task> &&
+             Scheduler::ProvidesTaskCreationHandler<TaskScheduler, Task> &&
+             TaskControllerProvidesBasicAllocationSupport<TaskController> &&
+             (BatchSize > 0)
+    struct BatchServiceRoutineBuilder
+    {
+        /// The descriptor of a thread, which packs the argument of each initializer in order
+        using Descriptor = SyscallArguments<typename Initializers::Arg...>;
+
+    private:
+        /// Private helper to run initializers with the arguments packed in the given descriptor
+        static bool initialize(Task* task, const Descriptor& descriptor)
+        {
+            return [&]<std::size_t... I>(std::index_sequence<I...>) -> bool
+            {
+                return KPI::TaskInitializerBuilderWithArgs<Task, Initializers...>{}(task, descriptor.template get<I>()...);
+            }(std::index_sequence_for<Initializers...>());
+        }
+
+    public:
+        ///
+        /// Create threads described by the given array
+        ///
+        /// @param task The current running task
+        /// @param descriptors A non-null array of thread descriptors
+        /// @param count The number of descriptors in the array
+        /// @return The next task that is selected to run.
+        ///
+        Task* operator()(Task* task, const Descriptor* descriptors, size_t count)
+        {
+            TaskController& controller = GetTaskController<TaskController>();
+
+            Task* batch[BatchSize];
+
+            Task* next = task;
+
+            size_t created = 0;
+
+            bool failed = false;
+
+            while (created < count && !failed)
+            {
+                size_t size = count - created < BatchSize ? count - created : BatchSize;
+
+                // Allocate task control blocks for the batch first
+                size_t allocated = 0;
+
+                while (allocated < size)
+                {
+                    Task* newTask = controller.allocate();
+
+                    if (newTask == nullptr)
+                    {
+                        perr("Failed to allocate a task control block for the thread %llu.", static_cast<unsigned long long>(created + allocated));
+
+                        failed = true;
+
+                        break;
+                    }
+
+                    batch[allocated++] = newTask;
+                }
+
+                // Run initializers in a tight loop
+                size_t initialized = 0;
+
+                while (initialized < allocated)
+                {
+                    if (!initialize(batch[initialized], descriptors[created + initialized]))
+                    {
+                        perr("Failed to initialize the task control block for the thread %llu.", static_cast<unsigned long long>(created + initialized));
+
+                        failed = true;
+
+                        break;
+                    }
+
+                    initialized += 1;
+                }
+
+                // Release task control blocks that have not been initialized
+                for (size_t index = initialized; index < allocated; index += 1)
+                {
+                    controller.release(batch[index]);
+                }
+
+                if (initialized != 0)
+                {
+                    next = NotifyTasksCreated<TaskScheduler>(next, batch, initialized);
+                }
+
+                created += initialized;
+            }
+
+            task->setSyscallKernelReturnValue(static_cast<int>(created));
+
+            return next;
+        }
+    };
+
+    ///
+    /// Build the kernel service routine that creates multiple threads from an array of descriptors supplied by the task
+    ///
+    /// @note System call arguments: the address of the array of descriptors followed by the number of descriptors.
+    /// @see `BatchServiceRoutineBuilder` for details.
+    ///
+    template <typename Task, typename TaskScheduler, typename TaskController, size_t BatchSize, typename... Initializers>
+    requires TaskConstraints::TaskCanInvokeSystemCall<Task> &&
+             Scheduler::ProvidesTaskCreationHandler<TaskScheduler, Task> &&
+             TaskControllerProvidesBasicAllocationSupport<TaskController> &&
+             (BatchSize > 0)
+    struct BatchServiceRoutineBuilderWithTaskArgs
+    {
+        /// The builder that creates threads
+        using Builder = BatchServiceRoutineBuilder<Task, TaskScheduler, TaskController, BatchSize, Initializers...>;
+
+        /// The descriptor of a thread
+        using Descriptor = typename Builder::Descriptor;
+
+        Task* operator()(Task* task)
+        {
+            auto descriptors = FetchSyscallArgument<const Descriptor*, 0>(task);
+
+            auto count = FetchSyscallArgument<size_t, 1>(task);
+
+            return Builder{}(task, descriptors, count);
+        }
+    };
+}
+
+/// Defines kernel service routines for the simple thread based execution model
+namespace KernelServiceRoutines::FinishThread
+{
+    /// Private subroutine to finalize and release a task control block
+    namespace KPI
+    {
+        ///
+        /// [KPI] Private subroutine to release the dedicated stack of a task that was allocated dynamically
+        ///
+        /// @tparam Task Specify the type of a task that has a dedicated recyclable stack
+        /// @note This subroutine is the counterpart of `CreateThread::KPI::AllocateDedicatedRecyclableStack`.
+        ///
+        template <typename Task>
+        requires TaskConstraints::TaskHasDedicatedRecyclableStack<Task>
+        struct ReleaseDedicatedStack
+        {
+            ///
+            /// Release the private stack of the given task
+            ///
+            /// @param task A non-null task control block
+            ///
+            void operator()(Task* task)
+            {
+                delete[] task->getPrivateStack();
+
+                task->setPrivateStack(nullptr);
+
+                task->setStackPointer(nullptr);
+            }
+        };
+
+        ///
+        /// [KPI] Private subroutine to discard the floating-point context of a task
+        ///
+        /// @tparam Task Specify the type of a task that has a floating-point context
+        /// @tparam Injector Specify the lazy context injector, i.e. `LazyFPUContextInjector`
+        /// @note The unit must not keep a reference to a released task control block,
+        ///       so developers must include this subroutine if the dispatcher switches the context lazily.
+        ///
+        template <typename Task, typename Injector>
+        requires TaskConstraints::TaskHasFPUContext<Task>
+        struct ReleaseFPUContext
+        {
+            ///
+            /// Discard the floating-point context of the given task
+            ///
+            /// @param task A non-null task control block
+            ///
+            void operator()(Task* task)
+            {
+                Injector::forget(task);
+            }
+        };
+
+        ///
+        /// [KPI] Private subroutine to release the dedicated stack of a task back to a static pool
+        ///
+        /// @tparam Task Specify the type of a task that has a dedicated recyclable stack
+        /// @tparam StackSize Specify the size of each stack in the pool
+        /// @tparam Count Specify the number of stacks in the pool
+        /// @tparam Alignment Specify the alignment of each stack in the pool
+        /// @note This subroutine is the counterpart of `CreateThread::KPI::PooledStackAllocator`,
+        ///       so developers must specify the same pool parameters.
+        ///
+        template <typename Task, size_t StackSize, size_t Count, size_t Alignment = alignof(std::max_align_t)>
+        requires TaskConstraints::TaskHasDedicatedRecyclableStack<Task>
+        struct ReleasePooledStack
+        {
+            /// The pool that provides stacks
+            using Pool = StaticStackPool<StackSize, Count, Alignment>;
+
+            ///
+            /// Release the private stack of the given task back to the pool
+            ///
+            /// @param task A non-null task control block
+            ///
+            void operator()(Task* task)
+            {
+                Pool::release(task->getPrivateStack());
+
+                task->setPrivateStack(nullptr);
+
+                task->setStackPointer(nullptr);
+            }
+        };
+
+        ///
+        /// [KPI] Private subroutine to release the dedicated stack of a task back to a pool of size classes
+        ///
+        /// @tparam Task Specify the type of a task that has a dedicated recyclable stack
+        /// @tparam Pool Specify the type of the size class stack pool
+        /// @note This subroutine is the counterpart of `CreateThread::KPI::SizeClassStackAllocator`,
+        ///       so developers must specify the same pool.
+        /// @note This subroutine reports an error if the guard at the stack limit has been overwritten.
+        ///
+        template <typename Task, typename Pool>
+        requires TaskConstraints::TaskHasDedicatedRecyclableStack<Task>
+        struct ReleaseSizeClassStack
+        {
+            ///
+            /// Release the private stack of the given task back to the pool
+            ///
+            /// @param task A non-null task control block
+            ///
+            void operator()(Task* task)
+            {
+                if (!Pool::isIntact(task->getPrivateStack()))
+                {
+                    perr("Task at 0x%p has overflowed its stack at 0x%p.", task, task->getPrivateStack());
+                }
+
+                Pool::release(task->getPrivateStack());
+
+                task->setPrivateStack(nullptr);
+
+                task->setStackPointer(nullptr);
+            }
+        };
+
+        ///
+        /// [KPI] Invoke a list of task control block finalizers
+        ///
+        /// @tparam Task Specify the type of a task control block
+        /// @tparam Finalizers Specify zero or more task control block finalizers
+        ///
+        template <typename Task, typename... Finalizers>
+        struct TaskFinalizerBuilder
+        {
+            ///
+            /// Execute selected list of task control block finalizers
+            ///
+            /// @param task A non-null task control block
+            /// @note Finalizers are executed in order and cannot fail.
+            ///
+            void operator()(Task* task)
+            {
+                (Finalizers{}(task), ...);
+            }
+        };
+    }
+
+    ///
+    /// A fixed-capacity list of finished tasks whose task control blocks and stacks are reclaimed in batches
+    ///
+    /// @tparam Task Specify the type of a task control block
+    /// @tparam TaskController Specify the type of a task controller
+    /// @tparam Capacity Specify the maximum number of finished tasks that can be parked on the list
+    /// @tparam Finalizers Specify zero or more task control block finalizers
+    /// @note The reaper is a collection of static functions and variables and assumes that it is accessed in the kernel.
+    /// @note The kernel should drain the list when the system is idle,
+    ///       by invoking `reap()` directly if the idle loop runs in the kernel,
+    ///       or by servicing a system call from the idle task with `ReaperServiceRoutineBuilder`.
+    ///
+    template <typename Task, typename TaskController, size_t Capacity, typename... Finalizers>
+    requires TaskControllerProvidesBasicAllocationSupport<TaskController> && (Capacity > 0)
+    struct TaskReaper
+    {
+    private:
+        /// Finished tasks that have not been reclaimed yet
+        static inline Task* tasks[Capacity];
+
+        /// The number of finished tasks on the list
+        static inline size_t count = 0;
+
+    public:
+        ///
+        /// Park the given finished task on the list
+        ///
+        /// @param task A non-null task control block that has been removed from the scheduler
+        /// @note If the list is full, the reaper reclaims all parked tasks first.
+        ///
+        static void park(Task* task)
+        {
+            if (count == Capacity)
+            {
+                reap();
+            }
+
+            tasks[count++] = task;
+        }
+
+        ///
+        /// Finalize and release all parked tasks
+        ///
+        /// @return The number of tasks that have been reclaimed.
+        ///
+        static size_t reap()
+        {
+            TaskController& controller = GetTaskController<TaskController>();
+
+            size_t reclaimed = count;
+
+            for (size_t index = 0; index < reclaimed; index += 1)
+            {
+                KPI::TaskFinalizerBuilder<Task, Finalizers...>{}(tasks[index]);
+
+                controller.release(tasks[index]);
+            }
+
+            count = 0;
+
+            return reclaimed;
+        }
+
+        ///
+        /// Get the number of tasks that are waiting to be reclaimed
+        ///
+        /// @return The number of parked tasks.
+        ///
+        static size_t pending()
+        {
+            return count;
+        }
+    };
+
+    ///
+    /// Build the kernel service routine that terminates the current thread
+    ///
+    /// @tparam Task Specify the type of a task control block
+    /// @tparam TaskScheduler Specify the type of a task scheduler
+    /// @tparam TaskController Specify the type of a task controller
+    /// @tparam Finalizers Specify zero or more task control block finalizers
+    /// @note The dispatcher still passes the finished task to injectors and the context switcher as the previous task,
+    ///       so its task control block and stack cannot be released before the dispatcher switches away from it.
+    ///       Instead, this service routine finalizes and releases the previously finished task, which has been switched away,
+    ///       and keeps the current one until the next thread finishes, so at most one finished task awaits reclamation.
+    ///       Use `DeferredServiceRoutineBuilder` to keep the reclamation off the critical path.
+    ///
+    template <typename Task, typename TaskScheduler, typename TaskController, typename... Finalizers>
+    requires Scheduler::ProvidesTaskTerminationHandler<TaskScheduler, Task> &&
+             TaskControllerProvidesBasicAllocationSupport<TaskController>
+    struct ServiceRoutineBuilder
+    {
+        /// The reaper that keeps the last finished task
+        using Reaper = TaskReaper<Task, TaskController, 1, Finalizers...>;
+
+        ///
+        /// Terminate the given task
+        ///
+        /// @param task The current running task that has finished
+        /// @return The next task that is selected to run.
+        ///
+        Task* operator()(Task* task)
+        {
+            // The task has finished
+            // Notify the scheduler before the task control block is released
+            Task* next = NotifyTaskFinished<TaskScheduler>(task);
+
+            // Release the previously finished task and keep this one until the dispatcher switches away from it
+            Reaper::park(task);
+
+            return next;
+        }
+    };
+
+    ///
+    /// Build the kernel service routine that terminates the current thread and defers the reclamation
+    ///
+    /// @tparam Task Specify the type of a task control block
+    /// @tparam TaskScheduler Specify the type of a task scheduler
+    /// @tparam Reaper Specify the type of the reaper that reclaims finished tasks in batches
+    /// @note This service routine only removes the task from the scheduler and parks it on the reaper list,
+    ///       so the thread exit does not pay for finalizers or releasing the task control block.
+    /// @seealso `TaskReaper` for details.
+    ///
+    template <typename Task, typename TaskScheduler, typename Reaper>
+    requires Scheduler::ProvidesTaskTerminationHandler<TaskScheduler, Task>
+    struct DeferredServiceRoutineBuilder
+    {
+        ///
+        /// Terminate the given task
+        ///
+        /// @param task The current running task that has finished
+        /// @return The next task that is selected to run.
+        ///
+        Task* operator()(Task* task)
+        {
+            Task* next = NotifyTaskFinished<TaskScheduler>(task);
+
+            Reaper::park(task);
+
+            return next;
+        }
+    };
+
+    ///
+    /// Build the kernel service routine that reclaims finished tasks parked on the reaper list
+    ///
+    /// @tparam Task Specify the type of a task control block
+    /// @tparam Reaper Specify the type of the reaper that reclaims finished tasks in batches
+    /// @note This service routine is expected to service the system call from the idle task.
+    ///       It returns the number of reclaimed tasks and resumes the caller.
+    ///
+    template <typename Task, typename Reaper>
+    requires TaskConstraints::TaskCanInvokeSystemCall<Task>
+    struct ReaperServiceRoutineBuilder
+    {
+        Task* operator()(Task* task)
+        {
+            task->setSyscallKernelReturnValue(static_cast<int>(Reaper::reap()));
+
+            return task;
+        }
+    };
+}
+
+/// Defines kernel service routines for balancing threads across cores
+namespace KernelServiceRoutines::BalanceLoad
+{
+    ///
+    /// Build the kernel service routine that admits a ready thread owned by the current core or steals one from a sibling core
+    ///
+    /// @tparam Task Specify the type of a task control block
+    /// @tparam Balancer Specify the type of the load balancer owned by each core, e.g. `WorkStealingBalancer`
+    /// @note This service routine is expected to be invoked in the kernel to service the system call `sysBalanceLoad()`.
+    ///
+    template <typename Task, typename Balancer>
+    struct ServiceRoutineBuilder
+    {
+        Task* operator()(Task* task)
+        {
+            return Balancer::balance(task);
+        }
+    };
+}
+
+/// Defines kernel service routines for sleeping threads
+namespace KernelServiceRoutines::Sleep
+{
+    /// Private subroutines shared by kernel service routines
+    namespace KPI
+    {
+        ///
+        /// [KPI] Private helper to get the current tick
+        ///
+        /// @tparam Wheel Specify the timer wheel
+        /// @tparam Timer Specify the timer policy, i.e. `PeriodicTimer` or a `TicklessTimer`
+        /// @return The tick of the hardware counter on a tickless kernel, or the tick of the wheel otherwise.
+        ///
+        template <typename Wheel, typename Timer>
+        static inline typename Wheel::Tick GetCurrentTick()
+        {
+            if constexpr (TicklessTimer<Timer>)
+            {
+                return static_cast<typename Wheel::Tick>(Timer::now());
+            }
+            else
+            {
+                return Wheel::now();
+            }
+        }
+
+        ///
+        /// [KPI] Private helper to program the hardware timer to the next tick at which the wheel needs attention
+        ///
+        /// @tparam Wheel Specify the timer wheel
+        /// @tparam Timer Specify the timer policy, i.e. `PeriodicTimer` or a `TicklessTimer`
+        /// @note The timer is stopped if no thread is sleeping, so an idle core is not woken up by empty ticks.
+        ///       This helper does nothing on a kernel that has a periodic tick.
+        ///
+        template <typename Wheel, typename Timer>
+        static inline void ProgramTimer()
+        {
+            if constexpr (TicklessTimer<Timer>)
+            {
+                std::optional<typename Wheel::Tick> distance = Wheel::getTicksUntilNextExpiry();
+
+                if (!distance)
+                {
+                    Timer::stop();
+
+                    return;
+                }
+
+                // The wheel only advances in the timer interrupt, so the deadline is relative to the tick of the wheel
+                auto ticks = static_cast<typename Wheel::Tick>(*distance - (static_cast<typename Wheel::Tick>(Timer::now()) - Wheel::now()));
+
+                // The deadline has passed while the kernel is running, so raise the interrupt on the next tick
+                if (static_cast<std::make_signed_t<typename Wheel::Tick>>(ticks) <= 0)
+                {
+                    ticks = 1;
+                }
+
+                Timer::program(static_cast<typename Timer::Tick>(ticks));
+            }
+        }
+
+        ///
+        /// [KPI] Private helper to put the given thread to sleep until the given tick
+        ///
+        /// @return The next task that is selected to run.
+        ///
+        template <typename Task, typename TaskScheduler, typename Wheel, typename Timer, typename Log>
+        static inline Task* SleepUntil(Task* task, typename Wheel::Tick deadline)
+        {
+            task->setSyscallKernelReturnValue(0);
+
+            // Guard: The deadline has passed, so the thread keeps running
+            if (!Wheel::insert(task, deadline))
+            {
+                return task;
+            }
+
+            if constexpr (Log::kInfo)
+            {
+                pinfo("Task at 0x%p sleeps until the tick %llu.", task, static_cast<unsigned long long>(deadline));
+            }
+
+            ProgramTimer<Wheel, Timer>();
+
+            return NotifyTaskFinished<TaskScheduler>(task);
+        }
+    }
+
+    ///
+    /// Kernel service routine to put the current thread to sleep for the given number of ticks
+    ///
+    /// @tparam Task Specify the type of the task control block that can sleep
+    /// @tparam TaskScheduler Specify the type of the scheduler that provides the task termination handler
+    /// @tparam Wheel Specify the timer wheel, e.g. `HierarchicalTimerWheel`
+    /// @tparam Timer Specify the timer policy, i.e. `PeriodicTimer` or a `TicklessTimer`
+    /// @tparam Log Specify the logging policy
+    /// @note System call arguments: the number of ticks.
+    /// @note The thread is removed from the scheduler until `TimerInterrupt` reaches its wakeup tick.
+    ///       Sleeping for zero ticks returns immediately.
+    ///
+    template <typename Task, typename TaskScheduler, typename Wheel, typename Timer = PeriodicTimer, typename Log = DefaultExecutionLog>
+    requires TaskConstraints::TaskCanInvokeSystemCall<Task> &&
+             TaskConstraints::TaskCanSleep<Task> &&
+             Scheduler::ProvidesTaskTerminationHandler<TaskScheduler, Task>
+    struct SyscallSleep
+    {
+        Task* operator()(Task* task)
+        {
+            auto ticks = FetchSyscallArgument<typename Wheel::Tick, 0>(task);
+
+            return KPI::SleepUntil<Task, TaskScheduler, Wheel, Timer, Log>(task, KPI::GetCurrentTick<Wheel, Timer>() + ticks);
+        }
+    };
+
+    ///
+    /// Kernel service routine to put the current thread to sleep until the given tick
+    ///
+    /// @tparam Task Specify the type of the task control block that can sleep
+    /// @tparam TaskScheduler Specify the type of the scheduler that provides the task termination handler
+    /// @tparam Wheel Specify the timer wheel, e.g. `HierarchicalTimerWheel`
+    /// @tparam Timer Specify the timer policy, i.e. `PeriodicTimer` or a `TicklessTimer`
+    /// @tparam Log Specify the logging policy
+    /// @note System call arguments: the absolute wakeup tick.
+    /// @note Periodic threads should sleep until the deadline computed from the previous one, so that their period does not drift.
+    ///       A deadline that has passed returns immediately.
+    ///
+    template <typename Task, typename TaskScheduler, typename Wheel, typename Timer = PeriodicTimer, typename Log = DefaultExecutionLog>
+    requires TaskConstraints::TaskCanInvokeSystemCall<Task> &&
+             TaskConstraints::TaskCanSleep<Task> &&
+             Scheduler::ProvidesTaskTerminationHandler<TaskScheduler, Task>
+    struct SyscallSleepUntil
+    {
+        Task* operator()(Task* task)
+        {
+            auto deadline = FetchSyscallArgument<typename Wheel::Tick, 0>(task);
+
+            return KPI::SleepUntil<Task, TaskScheduler, Wheel, Timer, Log>(task, deadline);
+        }
+    };
+
+    ///
+    /// Kernel service routine to handle the timer interrupt and wake up threads whose wakeup tick has been reached
+    ///
+    /// @tparam Task Specify the type of the task control block that can sleep
+    /// @tparam TaskScheduler Specify the type of the scheduler that provides the task creation handler
+    /// @tparam Wheel Specify the timer wheel, e.g. `HierarchicalTimerWheel`
+    /// @tparam Timer Specify the timer policy, i.e. `PeriodicTimer` or a `TicklessTimer`
+    /// @tparam Log Specify the logging policy
+    /// @note On a kernel that has a periodic tick, each interrupt advances the wheel by one tick.
+    ///       On a tickless kernel, the interrupt advances the wheel to the tick of the hardware counter in one go,
+    ///       and programs the timer to the next tick at which the wheel needs attention.
+    /// @note Each woken thread is admitted to the scheduler, which may preempt the interrupted task.
+    ///
+    template <typename Task, typename TaskScheduler, typename Wheel, typename Timer = PeriodicTimer, typename Log = DefaultExecutionLog>
+    requires TaskConstraints::TaskCanSleep<Task> &&
+             Scheduler::ProvidesTaskCreationHandler<TaskScheduler, Task>
+    struct TimerInterrupt
+    {
+        Task* operator()(Task* task)
+        {
+            TaskScheduler& scheduler = GetTaskScheduler<TaskScheduler>();
+
+            Task* next = task;
+
+            // A periodic tick advances the wheel by one tick, while a tickless kernel catches up with the hardware counter
+            auto target = static_cast<typename Wheel::Tick>(Wheel::now() + 1);
+
+            if constexpr (TicklessTimer<Timer>)
+            {
+                target = KPI::GetCurrentTick<Wheel, Timer>();
+            }
+
+            size_t woken = Wheel::advance(target, [&](Task* sleeper) -> void
+            {
+                next = scheduler.onTaskCreated(next, sleeper);
+            });
+
+            if constexpr (Log::kInfo)
+            {
+                if (woken != 0)
+                {
+                    pinfo("%llu threads have woken up at the tick %llu.", static_cast<unsigned long long>(woken), static_cast<unsigned long long>(target));
+                }
+            }
+
+            KPI::ProgramTimer<Wheel, Timer>();
+
+            return next;
+        }
+    };
+}
+
+/// Defines kernel service routines for waiting on a futex word
+namespace KernelServiceRoutines::FutexWait
+{
+    ///
+    /// Build the kernel service routine that blocks the current thread if the futex word still holds the expected value
+    ///
+    /// @tparam Task Specify the type of a task control block that can wait on a futex word
+    /// @tparam TaskScheduler Specify the type of a task scheduler
+    /// @tparam WaitQueues Specify the per-address wait queues, e.g. `FutexWaitQueues`
+    /// @tparam Log Specify the logging policy
+    /// @note The comparison and the enqueue are atomic with respect to `FutexWake`, since both run in the kernel,
+    ///       so a wake-up sent after the user space has observed the contended value is never lost.
+    /// @note The kernel return value is 0 if the thread has been woken up, or -1 if the word has changed before the thread waits,
+    ///       in which case the thread keeps running and retries in the user space.
+    ///
+    template <typename Task, typename TaskScheduler, typename WaitQueues, typename Log = DefaultExecutionLog>
+    requires TaskConstraints::TaskCanInvokeSystemCall<Task> &&
+             TaskConstraints::TaskCanWaitOnFutex<Task> &&
+             Scheduler::ProvidesTaskTerminationHandler<TaskScheduler, Task>
+    struct ServiceRoutineBuilder
+    {
+        ///
+        /// Block the given task on the given futex word
+        ///
+        /// @param task The current running task
+        /// @param address The address of the futex word
+        /// @param expected The value observed by the task in the user space
+        /// @return The next task that is selected to run.
+        ///
+        Task* operator()(Task* task, const FutexWord* address, UInt32 expected)
+        {
+            // Guard: The word has changed, e.g. the owner has unlocked the mutex in the meantime
+            if (address->load(std::memory_order_acquire) != expected)
+            {
+                task->setSyscallKernelReturnValue(-1);
+
+                return task;
+            }
+
+            if constexpr (Log::kInfo)
+            {
+                pinfo("Task at 0x%p waits on the futex word at 0x%p.", task, address);
+            }
+
+            task->setSyscallKernelReturnValue(0);
+
+            WaitQueues::enqueue(task, address);
+
+            return NotifyTaskFinished<TaskScheduler>(task);
+        }
+    };
+
+    ///
+    /// Build the kernel service routine that blocks the current thread with arguments supplied by the task
+    ///
+    /// @note System call arguments: the address of the futex word followed by the expected value.
+    /// @see `ServiceRoutineBuilder` for details.
+    ///
+    template <typename Task, typename TaskScheduler, typename WaitQueues, typename Log = DefaultExecutionLog>
+    requires TaskConstraints::TaskCanInvokeSystemCall<Task> &&
+             TaskConstraints::TaskCanWaitOnFutex<Task> &&
+             Scheduler::ProvidesTaskTerminationHandler<TaskScheduler, Task>
+    struct ServiceRoutineBuilderWithTaskArgs
+    {
+        Task* operator()(Task* task)
+        {
+            auto address = FetchSyscallArgument<const FutexWord*, 0>(task);
+
+            auto expected = FetchSyscallArgument<UInt32, 1>(task);
+
+            return ServiceRoutineBuilder<Task, TaskScheduler, WaitQueues, Log>{}(task, address, expected);
+        }
+    };
+}
+
+/// Defines kernel service routines for waking threads waiting on a futex word
+namespace KernelServiceRoutines::FutexWake
+{
+    ///
+    /// Build the kernel service routine that wakes up threads waiting on a futex word
+    ///
+    /// @tparam Task Specify the type of a task control block that can wait on a futex word
+    /// @tparam TaskScheduler Specify the type of a task scheduler
+    /// @tparam WaitQueues Specify the per-address wait queues, e.g. `FutexWaitQueues`
+    /// @tparam Log Specify the logging policy
+    /// @note Threads are woken up in the order in which they started waiting, and each of them is admitted to the scheduler,
+    ///       which may preempt the current thread.
+    /// @note The kernel return value is the number of threads that have been woken up.
+    ///
+    template <typename Task, typename TaskScheduler, typename WaitQueues, typename Log = DefaultExecutionLog>
+    requires TaskConstraints::TaskCanInvokeSystemCall<Task> &&
+             TaskConstraints::TaskCanWaitOnFutex<Task> &&
+             Scheduler::ProvidesTaskCreationHandler<TaskScheduler, Task>
+    struct ServiceRoutineBuilder
+    {
+        ///
+        /// Wake up to the given number of threads waiting on the given futex word
+        ///
+        /// @param task The current running task
+        /// @param address The address of the futex word
+        /// @param count The maximum number of threads to wake up
+        /// @return The next task that is selected to run.
+        ///
+        Task* operator()(Task* task, const FutexWord* address, UInt32 count)
+        {
+            TaskScheduler& scheduler = GetTaskScheduler<TaskScheduler>();
+
+            Task* next = task;
+
+            size_t woken = WaitQueues::dequeue(address, count, [&](Task* waiter) -> void
+            {
+                next = scheduler.onTaskCreated(next, waiter);
+            });
+
+            if constexpr (Log::kInfo)
+            {
+                pinfo("Task at 0x%p has woken up %llu threads waiting on the futex word at 0x%p.", task, static_cast<unsigned long long>(woken), address);
+            }
+
+            task->setSyscallKernelReturnValue(static_cast<int>(woken));
+
+            return next;
+        }
+    };
+
+    ///
+    /// Build the kernel service routine that wakes up threads with arguments supplied by the task
+    ///
+    /// @note System call arguments: the address of the futex word followed by the maximum number of threads to wake up.
+    /// @see `ServiceRoutineBuilder` for details.
+    ///
+    template <typename Task, typename TaskScheduler, typename WaitQueues, typename Log = DefaultExecutionLog>
+    requires TaskConstraints::TaskCanInvokeSystemCall<Task> &&
+             TaskConstraints::TaskCanWaitOnFutex<Task> &&
+             Scheduler::ProvidesTaskCreationHandler<TaskScheduler, Task>
+    struct ServiceRoutineBuilderWithTaskArgs
+    {
+        Task* operator()(Task* task)
+        {
+            auto address = FetchSyscallArgument<const FutexWord*, 0>(task);
+
+            auto count = FetchSyscallArgument<UInt32, 1>(task);
+
+            return ServiceRoutineBuilder<Task, TaskScheduler, WaitQueues, Log>{}(task, address, count);
+        }
+    };
 }
 
 #endif /* Execution_SimpleThreadBasedKernelServiceRoutines_hpp */
@@ -0,0 +1,297 @@
+//
+//  StackPool.hpp
+//  Execution
+//
+//  Created by FireWolf on 2026-10-14.
+//
+
+#ifndef Execution_StackPool_hpp
+#define Execution_StackPool_hpp
+
+#include <Types.hpp>
+#include <Debug.hpp>
+#include <cstddef>
+#include <cstring>
+#include <new>
+#include <array>
+#include <algorithm>
+#include <functional>
+#include <bit>
+#include <concepts>
+#include <utility>
+
+///
+/// A pool of fixed-size stacks backed by a statically reserved arena
+///
+/// @tparam StackSize Specify the size of each stack in bytes
+/// @tparam Count Specify the number of stacks in the pool
+/// @tparam Alignment Specify the alignment of each stack in bytes
+/// @note Both allocation and release take constant time.
+///       The pool threads an intrusive free list through released stacks,
+///       i.e. the link is stored at the start address of each free stack, which is its stack limit.
+///       Stacks that have never been allocated are handed out in order, so the pool needs no initialization pass.
+/// @note The pool is a collection of static functions and variables,
+///       so all users that specify the same template arguments share the same arena.
+/// @note The pool assumes that it is accessed in the kernel with interrupts disabled.
+///
+template <size_t StackSize, size_t Count, size_t Alignment = alignof(std::max_align_t)>
+requires (Count > 0) && (StackSize >= sizeof(void*)) && (StackSize % Alignment == 0)
+struct StaticStackPool
+{
+private:
+    /// A free stack in the pool
+    struct FreeStack
+    {
+        FreeStack* next;
+    };
+
+    /// The statically reserved arena
+    alignas(Alignment) static inline UInt8 arena[Count][StackSize];
+
+    /// The list of stacks that have been released to the pool
+    static inline FreeStack* freeList = nullptr;
+
+    /// The number of stacks that have never been allocated
+    static inline size_t numFreshStacks = Count;
+
+public:
+    /// The size of each stack in bytes
+    static constexpr size_t kStackSize = StackSize;
+
+    ///
+    /// Allocate a stack from the pool
+    ///
+    /// @return The start address of the stack on success, `nullptr` if the pool is exhausted.
+    ///
+    static UInt8* allocate()
+    {
+        // Prefer a recycled stack
+        if (freeList != nullptr)
+        {
+            FreeStack* stack = freeList;
+
+            freeList = stack->next;
+
+            return reinterpret_cast<UInt8*>(stack);
+        }
+
+        // Guard: Hand out a stack that has never been allocated
+        if (numFreshStacks == 0)
+        {
+            return nullptr;
+        }
+
+        return arena[Count - numFreshStacks--];
+    }
+
+    ///
+    /// Release a stack back to the pool
+    ///
+    /// @param stack The start address of a stack previously returned by `allocate()`
+    ///
+    static void release(UInt8* stack)
+    {
+        precondition(contains(stack), "The given stack does not belong to the pool.");
+
+        freeList = new (stack) FreeStack{freeList};
+    }
+
+    ///
+    /// Check whether the given stack belongs to the pool
+    ///
+    /// @param stack The start address of a stack
+    /// @return `true` if the stack is returned by the pool, `false` otherwise.
+    ///
+    static bool contains(const UInt8* stack)
+    {
+        auto address = reinterpret_cast<uintptr_t>(stack);
+
+        auto start = reinterpret_cast<uintptr_t>(&arena[0][0]);
+
+        return address >= start && address < start + sizeof(arena) && (address - start) % StackSize == 0;
+    }
+};
+
+/// Private helpers for stack pools
+namespace StackPoolKPI
+{
+    /// Check whether the given sizes are in strictly ascending order
+    template <size_t... Sizes>
+    constexpr bool isStrictlyAscending()
+    {
+        std::array<size_t, sizeof...(Sizes)> sizes = { Sizes... };
+
+        return std::adjacent_find(sizes.begin(), sizes.end(), std::greater_equal<>()) == sizes.end();
+    }
+}
+
+///
+/// Specify the constraint of a guard that protects the limit of a stack
+///
+/// @note The guard is installed when a stack is handed out and uninstalled when it is returned to the pool.
+///       A guard could be a canary word written at the stack limit or
+///       a memory protection region that traps on access to the stack limit if the hardware supports it.
+///
+template <typename Guard>
+concept StackLimitGuard = requires(Guard& guard, UInt8* stack, size_t size)
+{
+    ///
+    /// The guard can be initialized with zero arguments
+    ///
+    requires std::default_initializable<Guard>;
+
+    ///
+    /// The guard must implement the function that installs the guard at the limit of the given stack
+    ///
+    { guard.install(stack, size) } -> std::same_as<void>;
+
+    ///
+    /// The guard must implement the function that removes the guard from the limit of the given stack
+    ///
+    { guard.uninstall(stack, size) } -> std::same_as<void>;
+
+    ///
+    /// The guard must implement the function that checks whether the limit of the given stack has ever been crossed
+    ///
+    { guard.isIntact(stack, size) } -> std::same_as<bool>;
+};
+
+/// A guard that does not protect the stack limit at all
+struct NoStackLimitGuard
+{
+    /// The number of bytes reserved at the stack limit
+    static constexpr size_t kGuardSize = 0;
+
+    void install([[maybe_unused]] UInt8* stack, [[maybe_unused]] size_t size) {}
+
+    void uninstall([[maybe_unused]] UInt8* stack, [[maybe_unused]] size_t size) {}
+
+    bool isIntact([[maybe_unused]] UInt8* stack, [[maybe_unused]] size_t size)
+    {
+        return true;
+    }
+};
+
+///
+/// A guard that writes a canary word at the stack limit
+///
+/// @tparam Canary Specify the canary word
+/// @note The canary occupies the lowest word of the stack, so the usable stack size shrinks by one word.
+///       An overwritten canary implies that the task has overflowed its stack at some point.
+///
+template <UInt32 Canary = 0xDEADC0DE>
+struct StackCanaryGuard
+{
+    /// The number of bytes reserved at the stack limit
+    static constexpr size_t kGuardSize = sizeof(UInt32);
+
+    void install(UInt8* stack, [[maybe_unused]] size_t size)
+    {
+        const UInt32 canary = Canary;
+
+        memcpy(stack, &canary, sizeof(canary));
+    }
+
+    void uninstall([[maybe_unused]] UInt8* stack, [[maybe_unused]] size_t size) {}
+
+    bool isIntact(UInt8* stack, [[maybe_unused]] size_t size)
+    {
+        const UInt32 canary = Canary;
+
+        return memcmp(stack, &canary, sizeof(canary)) == 0;
+    }
+};
+
+///
+/// A pool of stacks segregated into several power-of-two size classes
+///
+/// @tparam Guard Specify the guard that protects the limit of each stack
+/// @tparam Pools Specify a list of `StaticStackPool`s, one per size class, in strictly ascending order of the stack size
+/// @note A request is serviced by the smallest class that fits the requested size,
+///       so workloads that mix small and large stacks do not have to size every stack for the worst case.
+///       If that class is exhausted, the request falls through to the next larger class.
+///       Both allocation and release take constant time bounded by the number of classes.
+/// @example Define a pool for small event workers and large protocol threads:
+///          `using Pool = SizeClassStackPool<StackCanaryGuard<>, StaticStackPool<512, 16>, StaticStackPool<16384, 2>>;`
+///
+template <StackLimitGuard Guard, typename... Pools>
+requires (sizeof...(Pools) > 0) &&
+         (std::has_single_bit(Pools::kStackSize) && ...) &&
+         (StackPoolKPI::isStrictlyAscending<Pools::kStackSize...>())
+struct SizeClassStackPool
+{
+    /// The guard that protects the limit of each stack
+    using GuardType = Guard;
+
+    /// The size of the largest stack in the pool
+    static constexpr size_t kMaxStackSize = std::max({ Pools::kStackSize... });
+
+    ///
+    /// Allocate a stack that can hold at least the given number of bytes
+    ///
+    /// @param size The requested stack size
+    /// @param prepare A functor that consumes the start address and the actual size of the stack before the guard is installed,
+    ///                e.g. to paint the stack, so that the preparation never overwrites the guard
+    /// @return The start address and the actual size of the stack on success, `{nullptr, 0}` if no class can service the request.
+    ///
+    template <typename Preparer>
+    requires std::invocable<Preparer&, UInt8*, size_t>
+    static std::pair<UInt8*, size_t> allocate(size_t size, Preparer&& prepare)
+    {
+        std::pair<UInt8*, size_t> stack = { nullptr, 0 };
+
+        // A fold expression that tries each class that fits the requested size in ascending order
+        // If one of them succeeds, the rest of them will not be examined
+        bool found = ((size <= Pools::kStackSize && (stack = { Pools::allocate(), Pools::kStackSize }).first != nullptr) || ...);
+
+        // Guard: No class can service the request
+        if (!found)
+        {
+            return { nullptr, 0 };
+        }
+
+        prepare(stack.first, stack.second);
+
+        Guard{}.install(stack.first, stack.second);
+
+        return stack;
+    }
+
+    ///
+    /// Allocate a stack that can hold at least the given number of bytes
+    ///
+    /// @param size The requested stack size
+    /// @return The start address and the actual size of the stack on success, `{nullptr, 0}` if no class can service the request.
+    ///
+    static std::pair<UInt8*, size_t> allocate(size_t size)
+    {
+        return allocate(size, []([[maybe_unused]] UInt8* stack, [[maybe_unused]] size_t actualSize) -> void {});
+    }
+
+    ///
+    /// Release a stack back to the pool
+    ///
+    /// @param stack The start address of a stack previously returned by `allocate()`
+    ///
+    static void release(UInt8* stack)
+    {
+        // A fold expression that returns the stack to the class that owns it
+        bool found = ((Pools::contains(stack) && (Guard{}.uninstall(stack, Pools::kStackSize), Pools::release(stack), true)) || ...);
+
+        precondition(found, "The given stack does not belong to the pool.");
+    }
+
+    ///
+    /// Check whether the limit of the given stack has ever been crossed
+    ///
+    /// @param stack The start address of a stack previously returned by `allocate()`
+    /// @return `true` if the guard is intact, `false` otherwise or if the stack does not belong to the pool.
+    ///
+    static bool isIntact(UInt8* stack)
+    {
+        // Only the class that owns the stack can examine its guard
+        return ((Pools::contains(stack) && Guard{}.isIntact(stack, Pools::kStackSize)) || ...);
+    }
+};
+
+#endif /* Execution_StackPool_hpp */
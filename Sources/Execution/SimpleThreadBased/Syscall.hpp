@@ -8,6 +8,78 @@
 #ifndef Execution_SimpleThreadBasedSyscall_hpp
 #define Execution_SimpleThreadBasedSyscall_hpp
 
+#include <Types.hpp>
+#include <atomic>
 
+// The kernel must implement the following system calls
+
+///
+/// [SYSCALL] Create multiple threads in one system call
+///
+/// @param descriptors A non-null array of thread descriptors defined by the kernel, e.g. the entry point, the stack, the priority and the identifier
+/// @param count The number of descriptors in the array
+/// @return The number of threads that have been created.
+/// @note The current thread is preempted at most once per batch after new threads have been admitted to the scheduler.
+///
+int sysCreateThreads(const void* descriptors, size_t count);
+
+///
+/// [SYSCALL] Terminate the current thread
+///
+/// @note This system call does not return.
+///
+void sysFinishThread();
+
+///
+/// [SYSCALL] Reclaim threads that have finished but not been reclaimed yet
+///
+/// @return The number of threads that have been reclaimed.
+/// @note This system call is expected to be invoked by the idle task,
+///       if the kernel defers the reclamation of finished threads.
+///
+int sysReapFinishedThreads();
+
+///
+/// [SYSCALL] Put the current thread to sleep for the given number of ticks
+///
+/// @param ticks The number of ticks to sleep
+/// @return 0 after the thread has woken up.
+///
+int sysSleep(UInt32 ticks);
+
+///
+/// [SYSCALL] Put the current thread to sleep until the given tick
+///
+/// @param deadline The tick at which the thread wakes up
+/// @return 0 after the thread has woken up, or immediately if the deadline has passed.
+///
+int sysSleepUntil(UInt32 deadline);
+
+///
+/// [SYSCALL] Block the current thread if the futex word still holds the expected value
+///
+/// @param address The address of the futex word
+/// @param expected The value observed by the caller
+/// @return 0 after the thread has been woken up, -1 if the word does not hold the expected value.
+/// @note This system call is expected to be invoked by `FutexMutex` and `FutexSemaphore` on contention only.
+///
+int sysFutexWait(const std::atomic<UInt32>* address, UInt32 expected);
+
+///
+/// [SYSCALL] Wake up threads waiting on the futex word
+///
+/// @param address The address of the futex word
+/// @param count The maximum number of threads to wake up
+/// @return The number of threads that have been woken up.
+///
+int sysFutexWake(const std::atomic<UInt32>* address, UInt32 count);
+
+///
+/// [SYSCALL] Admit a ready thread owned by the current core or steal one from a sibling core
+///
+/// @note This system call is expected to be invoked by the idle task,
+///       if the kernel balances threads across cores with `WorkStealingBalancer`.
+///
+void sysBalanceLoad();
 
 #endif /* Execution_SimpleThreadBasedSyscall_hpp */
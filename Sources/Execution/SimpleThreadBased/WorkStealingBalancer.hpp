@@ -0,0 +1,192 @@
+//
+//  WorkStealingBalancer.hpp
+//  Execution
+//
+//  Created by FireWolf on 2026-10-14.
+//
+
+#ifndef Execution_WorkStealingBalancer_hpp
+#define Execution_WorkStealingBalancer_hpp
+
+#include <Types.hpp>
+#include <Debug.hpp>
+#include <Scheduler/Scheduler.hpp>
+#include <Execution/Common/TaskConstraints.hpp>
+#include <Execution/Common/KernelServiceRoutines.hpp>
+#include <Execution/Common/ExecutionLog.hpp>
+#include <Execution/Common/PerCore.hpp>
+#include <Execution/Common/WorkStealingDeque.hpp>
+#include <concepts>
+
+///
+/// A work-stealing load balancer that distributes newly created threads across cores
+///
+/// @tparam Task Specify the type of the task control block that has a core affinity mask
+/// @tparam TaskScheduler Specify the type of the scheduler owned by each core
+/// @tparam Provider Specify the provider of the current core identifier
+/// @tparam Capacity Specify the maximum number of threads waiting to be admitted by each core; Must be a power of two
+/// @tparam Log Specify the logging policy
+/// @note Each core owns a ready deque in its own cache line and a scheduler declared with `OSDeclarePerCoreTaskSchedulerWithKernelServiceRoutine`.
+///       Developers pass the balancer as the task scheduler of `CreateThread` service routines,
+///       so that the balancer intercepts the creation of new threads before they reach the scheduler.
+/// @note A new thread is admitted to the scheduler of the creating core by default, so it can preempt the current task at once.
+///       Only if task control blocks are ordered by priority, i.e. `*lhs > *rhs` if `lhs` should preempt `rhs`,
+///       a new thread that can migrate to other cores and that the current task outranks is kept in the ready deque of the creating core instead,
+///       since it would not run on the creating core before the current task leaves the processor anyway.
+///       The scheduler itself is private to its core, so threads only migrate before they are admitted.
+/// @note The balancer admits all threads kept in the deque of a core as soon as the current task finishes or blocks,
+///       so the local scheduler always selects the next task among all ready threads, and a deferred thread never waits behind a lower priority one.
+///       Developers must therefore pass the balancer as the task scheduler of every service routine that removes the current task from the scheduler,
+///       e.g. `FinishThread`, `Futex::Wait` and `Sleep`, which notify it via `NotifyTaskFinished`.
+///       An idle core first admits a thread from its own deque (the most recent one, which is likely to be cache hot),
+///       then steals the oldest thread from the deque of a sibling core whose affinity mask permits the migration.
+/// @note A thread pinned to the creating core, or created when the deque is full, is admitted to the local scheduler immediately.
+///       The creating core always accepts a thread it has created, even if the core is not in the affinity mask.
+/// @note The idle task of each core is expected to invoke `sysBalanceLoad()`, which is serviced by `BalanceLoad::ServiceRoutineBuilder`.
+///       Developers may also balance the load from a periodic timer service routine to bound the admission latency.
+///
+template <typename Task, typename TaskScheduler, CoreIdentifierProvider Provider, size_t Capacity, typename Log = DefaultExecutionLog>
+requires TaskConstraints::TaskHasCoreAffinity<Task> &&
+         Scheduler::ProvidesTaskCreationHandler<TaskScheduler, Task> &&
+         (Provider::kNumCores <= 64)
+struct WorkStealingBalancer
+{
+private:
+    /// Threads that have been created on each core but not been admitted to any scheduler yet
+    static inline PerCoreStorage<WorkStealingDeque<Task, Capacity>, Provider> ready;
+
+    ///
+    /// Private helper to get the bit of the given core in an affinity mask
+    ///
+    /// @param core The core identifier
+    /// @return The mask that only contains the given core.
+    ///
+    static inline UInt64 bit(size_t core)
+    {
+        return UInt64{1} << core;
+    }
+
+    ///
+    /// Private helper to admit the given thread to the scheduler of the current core
+    ///
+    /// @param current The task that is currently selected to run
+    /// @param task A non-null thread to be admitted
+    /// @return The next task that is selected to run.
+    ///
+    static inline Task* admit(Task* current, Task* task)
+    {
+        return KernelServiceRoutines::GetTaskScheduler<TaskScheduler>().onTaskCreated(current, task);
+    }
+
+    ///
+    /// Private helper to check whether the given thread may wait in the ready deque until an idle core admits it
+    ///
+    /// @param current The current running task
+    /// @param task The newly created thread
+    /// @return `true` if the current task outranks the new thread, `false` if the new thread may preempt it or tasks are not ordered.
+    ///
+    static inline bool canDefer(Task* current, Task* task)
+    {
+        if constexpr (requires(const Task& lhs, const Task& rhs) { { lhs > rhs } -> std::convertible_to<bool>; })
+        {
+            return *current > *task;
+        }
+        else
+        {
+            return false;
+        }
+    }
+
+public:
+    ///
+    /// [Scheduler] Admit the newly created thread, or keep it in the ready deque of the current core
+    ///
+    /// @param current The current running task
+    /// @param task The newly created thread
+    /// @return The next task that is selected to run.
+    ///
+    static Task* onTaskCreated(Task* current, Task* task)
+    {
+        // Guard: The thread would preempt the current task, or tasks are not ordered by priority
+        if (!canDefer(current, task))
+        {
+            return admit(current, task);
+        }
+
+        UInt64 siblings = static_cast<UInt64>(task->getCoreAffinity()) & ~bit(Provider::getCurrentCoreIdentifier());
+
+        // Guard: The thread may run on other cores and the deque has room for it
+        if (siblings == 0 || !ready.current().push(task))
+        {
+            return admit(current, task);
+        }
+
+        return current;
+    }
+
+    ///
+    /// [Scheduler] Remove the finished or blocked task from the scheduler and admit all threads kept in the ready deque of the current core
+    ///
+    /// @param task The current running task that leaves the processor
+    /// @return The next task that is selected to run.
+    /// @note Threads are admitted after the scheduler has removed the task,
+    ///       so that each of them is compared with the next selected task rather than with the one that leaves.
+    ///
+    static Task* onTaskFinished(Task* task)
+    requires Scheduler::ProvidesTaskTerminationHandler<TaskScheduler, Task>
+    {
+        Task* next = KernelServiceRoutines::GetTaskScheduler<TaskScheduler>().onTaskFinished(task);
+
+        while (Task* deferred = ready.current().pop())
+        {
+            next = admit(next, deferred);
+        }
+
+        return next;
+    }
+
+    ///
+    /// Admit a thread owned by the current core, or steal one from a sibling core
+    ///
+    /// @param current The current running task, typically the idle task
+    /// @return The next task that is selected to run.
+    /// @note This function admits at most one thread, so the time spent in the kernel is bounded.
+    ///
+    static Task* balance(Task* current)
+    {
+        // Prefer threads created on this core
+        if (Task* task = ready.current().pop(); task != nullptr)
+        {
+            return admit(current, task);
+        }
+
+        size_t core = Provider::getCurrentCoreIdentifier();
+
+        auto accepts = [core](Task* task) -> bool
+        {
+            return (static_cast<UInt64>(task->getCoreAffinity()) & bit(core)) != 0;
+        };
+
+        // Visit siblings in a round-robin order starting from the next core, so thieves spread over victims
+        for (size_t offset = 1; offset < Provider::kNumCores; offset += 1)
+        {
+            size_t victim = (core + offset) % Provider::kNumCores;
+
+            Task* task = ready[victim].steal(accepts);
+
+            if (task != nullptr)
+            {
+                if constexpr (Log::kInfo)
+                {
+                    pinfo("Core %d has stolen a thread from the core %d.", static_cast<int>(core), static_cast<int>(victim));
+                }
+
+                return admit(current, task);
+            }
+        }
+
+        return current;
+    }
+};
+
+#endif /* Execution_WorkStealingBalancer_hpp */